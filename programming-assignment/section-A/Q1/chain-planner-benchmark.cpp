@@ -0,0 +1,109 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -O2
+ *
+ * Objective : Time the ChainPlanner against matrixChainMultiplication()
+ *
+ * Usage :
+ *   chain-planner-benchmark [n] [appended] [seed]
+ *
+ * For a random chain of n matricies it times
+ *   - a full rebuild with matrixChainMultiplication()
+ *   - a first plan() call (cache miss, built from scratch)
+ *   - a repeated plan() call (cache hit)
+ *   - plan() of the chain with `appended` more matricies (extension)
+ * and checks the planner costs against matrixChainMultiplication().
+ *
+ */
+
+#include <cstdlib>          // atoi, strtoull
+#include <iomanip>          // setw, setprecision
+#include <iostream>         // cout, cerr
+#include <vector>           // vector
+
+#include "../benchmark/bench.h"
+#include "../benchmark/generators.h"
+#include "chain-planner.h"
+#include "matrix-chain-multiplication.h"
+
+using namespace std;
+
+// best time of `repeat` calls of f, in micro seconds
+template <typename F> static double bestOf(int repeat, F f) {
+  double best = 0;
+  for (int r = 0; r < repeat; ++r) {
+    Clock::time_point start = Clock::now();
+    f();
+    double t = secondsSince(start);
+    best = r == 0 || t < best ? t : best;
+  }
+  return best * 1e6;
+}
+
+int main(int argc, char *argv[]) {
+
+  int n = argc >= 2 ? atoi(argv[1]) : 200;
+  int appended = argc >= 3 ? atoi(argv[2]) : 1;
+  uint64_t seed = argc >= 4 ? strtoull(argv[3], nullptr, 10) : 1;
+  const int repeat = 5;
+
+  // dimensions up to 50 keep matrixChainMultiplication() within int
+  Rng rng(seed);
+  vector<int> order = randomMatrixChain(n, 1, 50, rng);
+  vector<int> longer = order;
+  for (int k = 0; k < appended; ++k) {
+    longer.push_back(randomBetween(rng, 1, 50));
+  }
+
+  int expected = 0;
+  double full = bestOf(repeat, [&]() {
+    expected = matrixChainMultiplication(order);
+  });
+
+  // every call gets a new planner, so that it misses the cache
+  long long cost = 0;
+  double miss = bestOf(repeat, [&]() {
+    ChainPlanner planner;
+    cost = planner.plan(order)->cost;
+  });
+
+  ChainPlanner planner;
+  planner.plan(order);
+  double hit = bestOf(repeat, [&]() { planner.plan(order); });
+
+  // extensions are cached as well, so time each one on a fresh planner
+  // that only knows the shorter chain. Building that is not timed.
+  long long longerCost = 0;
+  double extension = 0;
+  for (int r = 0; r < repeat; ++r) {
+    ChainPlanner fresh;
+    fresh.plan(order);
+    Clock::time_point start = Clock::now();
+    longerCost = fresh.plan(longer)->cost;
+    double t = secondsSince(start) * 1e6;
+    extension = r == 0 || t < extension ? t : extension;
+    if (fresh.statistics().extensions != 1) {
+      cerr << "Error : longer chain was not built from the cached one\n";
+      return 1;
+    }
+  }
+
+  if (cost != expected || longerCost != matrixChainMultiplication(longer)) {
+    cerr << "Error : planner and matrixChainMultiplication() disagree\n";
+    return 1;
+  }
+
+  cout << fixed << setprecision(3);
+  cout << "matricies                   : " << n << " + " << appended << "\n";
+  cout << "minimum cost                : " << cost << "\n";
+  cout << "full rebuild (us)           : " << full << "\n";
+  cout << "plan, cache miss (us)       : " << miss << "\n";
+  cout << "plan, cache hit (us)        : " << hit << "\n";
+  cout << "plan, extension (us)        : " << extension << "\n";
+  cout << "extension vs full rebuild   : " << full / extension << "x\n";
+  return 0;
+}
@@ -0,0 +1,290 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Matrix chain ordering for callers that ask again and again
+ * Major Inputs  : Array of Matrix orders, as in matrix-chain-multiplication.h
+ * Major Outputs : A plan tree : cost and split of every sub-chain used
+ *
+ * Finished chains are cached, keyed by a hash of the order array. A chain
+ * that extends a cached one (same orders, more matricies at the end) only
+ * computes the new columns of the DP table : column j needs cost[i][k] for
+ * k < j, which the cached chain already has, so each appended matrix costs
+ * O(n^2) instead of the O(n^3) of a full rebuild.
+ *
+ * The tables are kept column by column, column j holding cost[1..j][j],
+ * so appending a matrix is appending a column (and only the lower
+ * triangle is stored). A finished column never changes, so an extension
+ * shares the columns of its prefix instead of copying them : a family of
+ * chains grown from one another costs one table, not one per entry.
+ *
+ * The cache is bounded both in entries and in table cells (each column
+ * counted once, however many entries share it).
+ *
+ * Costs are long long, long chains overflow int.
+ *
+ */
+
+#ifndef CHAIN_PLANNER_H
+#define CHAIN_PLANNER_H
+
+#include <algorithm>        // equal
+#include <cstdint>          // uint64_t
+#include <iterator>         // prev
+#include <limits.h>         // LLONG_MAX
+#include <list>             // list
+#include <memory>           // make_shared, shared_ptr
+#include <string>           // string
+#include <unordered_map>    // unordered_map
+#include <vector>           // vector
+
+#include "../benchmark/stats.h"
+
+// Matricies first..last (1 based) multiplied as (first..split)(split+1..last)
+struct PlanNode {
+  int first, last;
+  int split;         // 0 for a single matrix
+  long long cost;    // cost of this sub-chain
+  int left, right;   // child nodes, -1 for a single matrix
+};
+
+struct Plan {
+  long long cost;              // minimum multiplication cost
+  std::vector<PlanNode> nodes; // nodes[root] is the whole chain
+  int root;                    // -1 for an empty chain
+
+  // same format as printParenthesis() : (( A1 ( A2  A3 )) A4 )
+  std::string toString() const {
+    std::string res;
+    if (root >= 0) {
+      append(res, root);
+    }
+    return res;
+  }
+
+private:
+  void append(std::string &res, int n) const {
+    const PlanNode &node = nodes[n];
+    if (node.left < 0) {
+      res += " A" + std::to_string(node.first) + " ";
+      return;
+    }
+    res += "(";
+    append(res, node.left);
+    append(res, node.right);
+    res += ")";
+  }
+};
+
+class ChainPlanner {
+
+public:
+  struct Stats {
+    uint64_t hits;        // plan found in the cache
+    uint64_t extensions;  // built from a cached prefix
+    uint64_t builds;      // built from scratch
+    uint64_t columns;     // DP columns computed in total
+  };
+
+private:
+  // column j of the tables : matricies i..j for i = 1..j
+  struct Column {
+    std::vector<long long> cost; // cost[i]
+    std::vector<int> split;      // split[i]
+  };
+
+  struct Entry {
+    std::vector<int> order;
+    std::vector<std::shared_ptr<const Column>> columns; // shared with prefixes
+    std::shared_ptr<const Plan> plan;
+    std::list<uint64_t>::iterator lru;
+  };
+
+  size_t capacity;
+  size_t maxCells;
+  size_t cells; // cells of all the columns held by the cache
+  std::unordered_multimap<uint64_t, std::shared_ptr<Entry>> cache;
+  std::list<uint64_t> lru; // hashes, most recently used first
+  Stats stats;
+
+  // entries point into `lru`, a copy would share them
+  ChainPlanner(const ChainPlanner &) = delete;
+  ChainPlanner &operator=(const ChainPlanner &) = delete;
+
+  // hashes of order[0..k] for every k, each one from the previous
+  static std::vector<uint64_t> prefixHashes(const std::vector<int> &order) {
+    std::vector<uint64_t> h(order.size());
+    uint64_t x = 1469598103934665603ull;
+    for (size_t k = 0; k < order.size(); ++k) {
+      x = (x ^ static_cast<uint32_t>(order[k])) * 1099511628211ull;
+      x ^= x >> 29;
+      h[k] = x;
+    }
+    return h;
+  }
+
+  // cached entry for exactly order[0..len), or null
+  std::shared_ptr<Entry> find(uint64_t hash, const std::vector<int> &order,
+                              size_t len) {
+    auto range = cache.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      const std::vector<int> &o = it->second->order;
+      if (o.size() == len && std::equal(o.begin(), o.end(), order.begin())) {
+        return it->second;
+      }
+    }
+    return nullptr;
+  }
+
+  void touch(Entry &e, uint64_t hash) {
+    lru.erase(e.lru);
+    lru.push_front(hash);
+    e.lru = lru.begin();
+  }
+
+  // frees the columns no other entry shares
+  void release(const Entry &e) {
+    for (auto &col : e.columns) {
+      if (col && col.use_count() == 1) {
+        cells -= col->cost.size();
+      }
+    }
+  }
+
+  // drops the least recently used entries, but never the newest one
+  void evict() {
+    while ((cache.size() > capacity || cells > maxCells) && lru.size() > 1) {
+      uint64_t hash = lru.back();
+      auto range = cache.equal_range(hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->lru == std::prev(lru.end())) {
+          release(*it->second);
+          cache.erase(it);
+          break;
+        }
+      }
+      lru.pop_back();
+    }
+  }
+
+  // adds the columns of matricies e.columns.size() .. n
+  void extend(Entry &e) {
+    const std::vector<int> &order = e.order;
+    int n = order.size() - 1;
+    if (e.columns.empty()) {
+      // column 0 is unused, matricies are labelled from 1
+      e.columns.emplace_back();
+    }
+
+    for (int j = e.columns.size(); j <= n; ++j) {
+      auto column = std::make_shared<Column>();
+      std::vector<long long> &col = column->cost;
+      std::vector<int> &colSplit = column->split;
+      col.resize(j + 1);
+      colSplit.resize(j + 1);
+      col[j] = 0;
+
+      // bottom up : cost[k+1..j] for k >= i is already in this column
+      for (int i = j - 1; i >= 1; --i) {
+        long long best = LLONG_MAX;
+        int bestSplit = i;
+        for (int k = i; k < j; ++k) {
+          STAT_COUNT("chain-planner.part_iterations");
+          long long c = e.columns[k]->cost[i] + col[k + 1] +
+                        (long long)order[i - 1] * order[k] * order[j];
+          if (c < best) {
+            best = c;
+            bestSplit = k;
+          }
+        }
+        col[i] = best;
+        colSplit[i] = bestSplit;
+      }
+
+      e.columns.push_back(column);
+      cells += j + 1;
+      stats.columns++;
+    }
+  }
+
+  static int buildNode(const Entry &e, Plan &plan, int first, int last) {
+    int id = plan.nodes.size();
+    const Column &col = *e.columns[last];
+    plan.nodes.push_back(PlanNode{first, last, 0, col.cost[first], -1, -1});
+    if (first < last) {
+      int k = col.split[first];
+      int left = buildNode(e, plan, first, k);
+      int right = buildNode(e, plan, k + 1, last);
+      plan.nodes[id].split = k;
+      plan.nodes[id].left = left;
+      plan.nodes[id].right = right;
+    }
+    return id;
+  }
+
+  static std::shared_ptr<const Plan> buildPlan(const Entry &e) {
+    auto plan = std::make_shared<Plan>();
+    int n = e.order.size() - 1;
+    plan->cost = n >= 1 ? e.columns[n]->cost[1] : 0;
+    plan->root = n >= 1 ? buildNode(e, *plan, 1, n) : -1;
+    return plan;
+  }
+
+public:
+  // at most `_capacity` chains and `_maxCells` table cells (12 bytes each)
+  // are cached, the newest chain is kept even if it alone is larger
+  explicit ChainPlanner(size_t _capacity = 256, size_t _maxCells = 1 << 24)
+      : capacity(_capacity ? _capacity : 1), maxCells(_maxCells), cells(0),
+        stats(Stats{0, 0, 0, 0}) {}
+
+  const Stats &statistics() const { return stats; }
+  size_t size() const { return cache.size(); }
+  size_t tableCells() const { return cells; }
+
+  // best multiplication order of the chain, from the cache if possible
+  std::shared_ptr<const Plan> plan(const std::vector<int> &order) {
+
+    if (order.size() < 2) {
+      return std::make_shared<Plan>(Plan{0, {}, -1});
+    }
+
+    std::vector<uint64_t> h = prefixHashes(order);
+    uint64_t hash = h.back();
+
+    std::shared_ptr<Entry> hit = find(hash, order, order.size());
+    if (hit) {
+      stats.hits++;
+      touch(*hit, hash);
+      return hit->plan;
+    }
+
+    // longest cached chain this one extends
+    auto entry = std::make_shared<Entry>();
+    for (size_t len = order.size() - 1; len >= 2; --len) {
+      std::shared_ptr<Entry> prefix = find(h[len - 1], order, len);
+      if (prefix) {
+        touch(*prefix, h[len - 1]);
+        entry->columns = prefix->columns; // shared, not copied
+        break;
+      }
+    }
+    (entry->columns.empty() ? stats.builds : stats.extensions)++;
+
+    entry->order = order;
+    extend(*entry);
+    entry->plan = buildPlan(*entry);
+
+    lru.push_front(hash);
+    entry->lru = lru.begin();
+    cache.emplace(hash, entry);
+    evict();
+
+    return entry->plan;
+  }
+};
+
+#endif
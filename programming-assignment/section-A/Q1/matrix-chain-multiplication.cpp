@@ -13,9 +13,10 @@
  */
 
 #include <iostream>         // cin, cout
-#include <limits.h>         // INT_MAX
 #include <vector>           // vector
-#include <algorithm>        // iota
+#include <numeric>          // iota
+
+#include "matrix-chain-multiplication.h"
 
 using namespace std;
 
@@ -47,7 +48,7 @@ void print1D(vector<int>& A){
   cout <<"\n\n";
 }
 
-void printParenthesisHelper(vector<vector<int>>& brackets, int i, int j, auto& name){
+void printParenthesisHelper(vector<vector<int>>& brackets, int i, int j, vector<int>::iterator& name){
 	if(i==j){
 		cout << " A" << *name << " " ;
 		name++;
@@ -68,58 +69,6 @@ void printParenthesis(vector<vector<int>>& brackets){
 	printParenthesisHelper(brackets, 1, noOfMatricies, it );
 }
 
-int matrixChainMultiplication(vector<int>& order) {
-
-  // no of matricies : from 1 to n
-  int n = order.size() - 1;
-
-  // Table rows and columns are labelled from 1 to n
-  // so for simplicity allocate n+1 rows and columns
-  vector<vector<int>> memo(n + 1, vector<int>(n + 1));
-  vector<vector<int>> brackets(n + 1, vector<int>(n + 1));
-
-  // chainSize range is : m[1,1] => m[1,2] => m[1,3] => ... => m[1,n]
-
-  // for chainSize = 1  : m[1,1] .. m[2,2] .. m[n,n] :: multiplication cost = 0
-  for (int i = 1; i <= n; ++i) {
-    memo[i][i] = 0;
-  }
-
-  // for chainSize = 2 to n
-  for (int chainSize = 2; chainSize <= n; ++chainSize) {
-
-    // establish an interval (start..end) of size = chainSize
-    // and loop through all possible intervals of size = chainSize
-    for (int start = 1; start + chainSize - 1 <= n; ++start) {
-
-      int end = start + chainSize - 1;
-
-      int minCostOfInterval = INT_MAX;
-      int partitionIndex;
-
-      // partition current interval into subintervals (start..part), (part+1,
-      // end) and find out which of them costs minimum
-      for (int part = start; part + 1 <= end; ++part) {
-
-        int currentSubIntervalCost =
-            memo[start][part] + memo[part + 1][end] +
-            order[start - 1] * order[part] * order[end];
-
-        if (currentSubIntervalCost < minCostOfInterval) {
-          minCostOfInterval = currentSubIntervalCost;
-          partitionIndex = part;
-        }
-      }
-      memo[start][end] = minCostOfInterval;
-      brackets[start][end] = partitionIndex;
-    }
-  }
-
-//  print2D(brackets);
-  cout << "\nMultiplication order is : " ; printParenthesis(brackets);
-  return memo[1][n];
-}
-
 int main() {
 
   /*
@@ -171,7 +120,10 @@ int main() {
 				}
 			}
 			
-			cout << "\nMultiplication Cost is  : " << matrixChainMultiplication(order);
+			vector<vector<int>> brackets;
+			int cost = matrixChainMultiplication(order, brackets);
+			cout << "\nMultiplication order is : " ; printParenthesis(brackets);
+			cout << "\nMultiplication Cost is  : " << cost;
 		}
 		catch(const char* err){
 			cout << err;
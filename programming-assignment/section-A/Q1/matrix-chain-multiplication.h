@@ -0,0 +1,89 @@
+/*
+ * Author : Jatin Rohilla, moved into this header by agent (Oct-2026)
+ * Date   : 23-10-2018
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Classic Matrix chain multiplication Problem
+ * Major Inputs  : Array of Matrix orders
+ * Major Outputs : Minimum multiplication cost and the split point table
+ *
+ * Order of matrix 'i' is given by order[i-1] x order[i]
+ *
+ */
+
+#ifndef MATRIX_CHAIN_MULTIPLICATION_H
+#define MATRIX_CHAIN_MULTIPLICATION_H
+
+#include <limits.h>         // INT_MAX
+#include <vector>           // vector
+
+// benchmark/stats-overhead.cpp keeps a copy of this solver without the
+// STAT_ lines (plainMatrixChain), a change here has to be made there too.
+#include "../benchmark/stats.h"
+
+// Fills brackets[i][j] with the best split point of matricies i..j
+// and returns the minimum multiplication cost of the whole chain
+inline int matrixChainMultiplication(const std::vector<int> &order,
+                                     std::vector<std::vector<int>> &brackets) {
+
+  STAT_PHASE("matrix-chain.total");
+
+  // no of matricies : from 1 to n
+  int n = order.size() - 1;
+
+  // Table rows and columns are labelled from 1 to n
+  // so for simplicity allocate n+1 rows and columns
+  std::vector<std::vector<int>> memo(n + 1, std::vector<int>(n + 1));
+  brackets.assign(n + 1, std::vector<int>(n + 1));
+
+  // chainSize range is : m[1,1] => m[1,2] => m[1,3] => ... => m[1,n]
+
+  // for chainSize = 1  : m[1,1] .. m[2,2] .. m[n,n] :: multiplication cost = 0
+  for (int i = 1; i <= n; ++i) {
+    memo[i][i] = 0;
+  }
+
+  // for chainSize = 2 to n
+  for (int chainSize = 2; chainSize <= n; ++chainSize) {
+
+    // establish an interval (start..end) of size = chainSize
+    // and loop through all possible intervals of size = chainSize
+    for (int start = 1; start + chainSize - 1 <= n; ++start) {
+
+      int end = start + chainSize - 1;
+
+      int minCostOfInterval = INT_MAX;
+      int partitionIndex = start;
+
+      // partition current interval into subintervals (start..part), (part+1,
+      // end) and find out which of them costs minimum
+      for (int part = start; part + 1 <= end; ++part) {
+        STAT_COUNT("matrix-chain.part_iterations");
+
+        int currentSubIntervalCost =
+            memo[start][part] + memo[part + 1][end] +
+            order[start - 1] * order[part] * order[end];
+
+        if (currentSubIntervalCost < minCostOfInterval) {
+          minCostOfInterval = currentSubIntervalCost;
+          partitionIndex = part;
+        }
+      }
+      memo[start][end] = minCostOfInterval;
+      brackets[start][end] = partitionIndex;
+    }
+  }
+
+  return n >= 1 ? memo[1][n] : 0;
+}
+
+// Same, when only the cost is needed
+inline int matrixChainMultiplication(const std::vector<int> &order) {
+  std::vector<std::vector<int>> brackets;
+  return matrixChainMultiplication(order, brackets);
+}
+
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Author : Jatin Rohilla, moved into this header by agent (Oct-2026)
+ * Date   : Nov-2018
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+
+Objective : Implement BellmanFord's Single source shortest Path (SSSP) algorithm
+
+*/
+
+#ifndef BELLMAN_FORD_SHORTEST_PATH_H
+#define BELLMAN_FORD_SHORTEST_PATH_H
+
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <list>
+#include <string>
+#include <vector>
+
+// benchmark/stats-overhead.cpp keeps a copy of this solver without the
+// STAT_ lines (PlainBellmanFord), a change here has to be made there too.
+#include "../benchmark/stats.h"
+
+namespace bellman_ford {
+
+typedef std::pair<int, int> pii;
+typedef std::list<pii> lpii;
+
+class Graph {
+
+private:
+  int V;         // no of vertices
+  int E;         // no of Edges
+  lpii *adjList; // adjacent List Representation
+  void print_path(int);
+  std::string graphType; // directed or undirected
+
+  // result of the last shortest_path() call
+  std::vector<int> dist;   // distance to each vertex, INT_MAX if unreachable
+  std::vector<int> parent; // previous vertex on the path, -1 for the source
+
+  Graph(const Graph &) = delete;
+  Graph &operator=(const Graph &) = delete;
+
+public:
+  Graph(int, std::string);
+  ~Graph();
+  void add_edge(int, int, int);
+  bool shortest_path(int);
+  void print_paths();
+  const std::vector<int> &distances() const { return dist; }
+  const std::vector<int> &parents() const { return parent; }
+};
+
+inline Graph::Graph(int _V, std::string _graphType) {
+  this->V = _V;
+  this->E = 0;
+  this->graphType = _graphType;
+  adjList = new lpii[_V];
+}
+
+inline Graph::~Graph() { delete[] adjList; }
+
+inline void Graph::add_edge(int u, int v, int w) {
+
+  // Because it is a directed graph
+  adjList[u].push_back({v, w});
+
+  if ((this->graphType).compare("undirected") == 0) {
+    adjList[v].push_back({u, w});
+  }
+
+  // edge count increases
+  (this->E)++;
+}
+
+inline void Graph::print_path(int v) {
+  if (v == -1) {
+    return;
+  }
+  print_path(parent[v]);
+  std::cout << v << ' ';
+}
+
+// BellmanFord's Single source shortest Path Algorithm
+// The result is kept in `dist` and `parent`.
+// returns false if a negative cycle is reachable from src
+inline bool Graph::shortest_path(int src) {
+
+  STAT_PHASE("bellman-ford.shortest_path");
+
+  int V = this->V;
+
+  // distance to each vertex
+  dist.assign(V, INT_MAX);
+  dist[src] = 0; // distance from source to source always zero
+
+  parent.assign(V, -1); // create a parent to store path info
+  parent[src] = -1;     // parent of source is base case
+
+  // outer loop executes V-1 times
+  for (int count = 1; count <= V - 1; ++count) {
+    STAT_COUNT("bellman-ford.passes");
+
+    // Inner loop executes E times
+    // Adjacency List Representation of the Graph, essentially traverses all E's
+    for (int i = 0; i < V; ++i) {
+      for (auto x : adjList[i]) {
+
+        int u = i;        // source of the edge
+        int v = x.first;  // dest of edge
+        int w = x.second; // weight of the edge
+
+        STAT_COUNT("bellman-ford.edge_checks");
+        if (dist[u] != INT_MAX && (dist[u] + w < dist[v])) {
+          dist[v] = dist[u] + w;
+          parent[v] = u;
+          STAT_COUNT("bellman-ford.useful_updates");
+        }
+      }
+    }
+  }
+
+  // traverse all Edges once more,
+  // if anything gets updated, it contains a negative cycle.
+  for (int i = 0; i < V; ++i) {
+    for (auto x : adjList[i]) {
+      int u = i;
+      int v = x.first;
+      int w = x.second;
+
+      if (dist[u] != INT_MAX && (dist[u] + w < dist[v])) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// prints the result of the last shortest_path() call
+inline void Graph::print_paths() {
+  std::cout << std::setw(8) << "Vertex" << std::setw(8) << "Cost";
+  std::cout << std::setw(8) << "Path";
+  std::cout << "\n";
+  for (int i = 0; i < V; i++) {
+    std::cout << std::setw(6) << i << std::setw(9) << dist[i];
+    std::cout << std::setw(6);
+    print_path(i);
+    std::cout << "\n";
+  }
+}
+
+} // namespace bellman_ford
+
+#endif
@@ -0,0 +1,429 @@
+/*
+ * Author : Jatin Rohilla, moved into this header by agent (Oct-2026)
+ * Date   : Nov-2018
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ 
+Objective : Implement Dijkstra's Single source shortest Path (SSSP) algorithm
+
+Appropriate Data structure :
+
+Requirements :
+1. Need smallest element at all stages
+2. Need to be able to update the value of the vertex node
+
+Consideration :
+
+1. Normal array : ( REJECTED )
+will take order N to extract min
+
+2. priority_queue : ( REJECTED )
+will get min at all stages
+But does not support updation of random vertices because it is a list
+
+3. Set : ( REJECTED )
+will get min at all stages because set is sorted
+also supports linear access, so updation is also possible
+But overall time taken is very much
+ 
+4. Min Heap : ( ACCEPTED )
+will get min i.e. the top element
+also supports update key
+
+TRICK :
+
+Min Heap in STL is implemented by priority queue.
+So we are back to consideration number 2.
+In practice, if we choose the
+insert-again version of dikstra's ( doable with priority queue )
+instead of
+update-key version ( will need update key )
+the time complexity turns out to be better
+Because priority queue is a logN data structure
+and a few extra items do not degrade its expected performance.
+
+Refer -
+https://stackoverflow.com/a/31123108/5371996
+https://stackoverflow.com/questions/9255620/why-does-dijkstras-algorithm-use-decrease-key
+
+so, we use
+priority_queue of STL ( a heap, but without the decrease-key operation)
+with the
+insert-again version of Djikstra's algorithm.
+
+This version works because we keep track of the extracted-vertex,
+once it has been extracted as min, we can ignore all its future occurences in queue.
+
+Time complexity is :
+Refer - https://youtu.be/xhG2DyCX3uA?t=4716
+
+|V| * extractMin + |E| * decrease key
+
+Array           : O(V^2)
+Binary Heap     : O( (V+E) logV)
+Fibonacci Heap  : O( VlogV + E)
+
+Note that -
+A decrease key takes logV in a binary heap, but here
+we are using priority_queue.
+Interestingly, the amortized cost of inserting ( and popping )
+an element from priority queue is also logN
+so the resultant time complexity is same as that of a binary heap.
+
+so we have here, (V+E)logV
+Because edges > vertices, we can take (E+E)logV = 2E(logV)
+i.e. Time = O( ElogV )
+
+*/
+
+#ifndef DIJKSTRA_SHORTEST_PATH_H
+#define DIJKSTRA_SHORTEST_PATH_H
+
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <list>
+#include <queue>
+#include <string>
+#include <vector>
+
+// benchmark/stats-overhead.cpp keeps a copy of this solver without the
+// STAT_ lines (PlainDijkstra), a change here has to be made there too.
+#include "../benchmark/stats.h"
+
+namespace dijkstra {
+
+typedef std::pair<int, int> pii;
+typedef std::list<pii> lpii;
+
+// new weight `w` for the edge u -> v (both ways if undirected)
+struct EdgeUpdate {
+  int u, v, w;
+};
+
+class Graph {
+
+  private:
+    int V;         // no of vertices
+    int E;         // no of Edges
+    lpii *adjList; // adjacent List Representation
+    lpii *inList;  // incoming edges, same as adjList if undirected
+    void print_path(int);
+    std::string graphType; // directed or undirected
+
+    // result of the last shortest_path() call
+    int source;              // -1 until shortest_path() has been called
+    std::vector<int> dist;   // distance to each vertex, INT_MAX if unreachable
+    std::vector<int> parent; // previous vertex on the path, -1 for the source
+    std::vector<bool> affected; // scratch space of update_edges()
+
+    int set_weight(lpii &, int, int);
+
+    Graph(const Graph &) = delete;
+    Graph &operator=(const Graph &) = delete;
+
+  public:
+    Graph(int, std::string);
+    ~Graph();
+    void add_edge(int, int, int);
+    void shortest_path(int);
+    void update_edge(int, int, int);
+    void update_edges(const std::vector<EdgeUpdate> &);
+    void print_paths();
+    const std::vector<int> &distances() const { return dist; }
+    const std::vector<int> &parents() const { return parent; }
+};
+
+inline Graph::Graph(int _V, std::string _graphType) {
+  this->V = _V;
+  this->E = 0;
+  this->graphType = _graphType;
+  this->source = -1;
+  adjList = new lpii[_V];
+  inList = _graphType.compare("undirected") == 0 ? adjList : new lpii[_V];
+}
+inline Graph::~Graph() {
+  if (inList != adjList) {
+    delete[] inList;
+  }
+  delete[] adjList;
+}
+
+inline void Graph::add_edge(int u, int v, int w) {
+  // Because it is an undirected graph
+  adjList[u].push_back({v, w});
+
+  if ((this->graphType).compare("undirected") == 0) {
+    adjList[v].push_back({u, w});
+  } else {
+    inList[v].push_back({u, w});
+  }
+
+  // edge count increases
+  (this->E)++;
+}
+
+inline void Graph::print_path(int v) {
+  if (v == -1) {
+    return;
+  }
+  print_path(parent[v]);
+  std::cout << v << ' ';
+}
+
+// Djikstra's Single source shortest Path Algorithm
+// The result is kept in `dist` and `parent`
+inline void Graph::shortest_path(int src) {
+
+  STAT_PHASE("dijkstra.shortest_path");
+
+  // using priority queue to reduce the time complexity
+
+  /*
+    priority queue stores a pair of integers
+	first  : distance from source to this vertex
+	second : the vertex label
+  */
+  
+// using the default nature of greater on a custom type `pii` : not a good practice
+// priority_queue<pii, vector<pii>, greater<pii>> pq;
+  
+//  readily providing greater<> functionality to custom type : STL way
+//  auto comparer = [](const auto& a, const auto& b) { return a.first > b.first; };
+//  priority_queue<pii, vector<pii>, decltype(comparer)> pq(comparer);
+//  cout << "\n\n" << typeid(comparer).name() << "\n\n";
+
+//  readily providing greater<> functionality to custom type with struct as template type
+  struct comparer{
+  	bool operator()(const pii& a, const pii& b) { return a.first > b.first; }
+  };
+  std::priority_queue<pii, std::vector<pii>, comparer> pq;
+
+  source = src;
+
+  // distance to each vertex
+  dist.assign(V, INT_MAX);
+
+  dist[src] = 0;             // distance from source to source always zero
+  pq.push({dist[src], src}); // pair of (distance from source to V, V)
+  STAT_COUNT("dijkstra.heap_pushes");
+
+  parent.assign(V, -1);  // create a parent to store path info
+  parent[src] = -1;      // parent of source is base case
+
+  // In Djikstra, vertex is extracted only once, thereafter it is not updated
+  std::vector<bool> firstExtraction(V, true);
+
+  // loop until all vertices have been extracted
+  while (!pq.empty()) {
+
+    // extract minimum distance vertex from pq
+    int u = pq.top().second;    // .second gives the vertex label
+    pq.pop();
+    STAT_COUNT("dijkstra.heap_pops");
+    if (!firstExtraction[u]) {
+      STAT_COUNT("dijkstra.stale_pops");
+    }
+    firstExtraction[u] = false;
+
+    // iterate all adjacent vertices to `u`
+    for (auto x : adjList[u]) {
+
+      int v = x.first;      // dest of edge
+      int w = x.second;     // weight of the edge
+
+      // if already extracted, do not proceed
+      // update cost of all adjacent vertices
+      if (firstExtraction[v] && (dist[u] + w < dist[v])) {
+        dist[v] = dist[u] + w;
+		parent[v] = u;
+		STAT_COUNT("dijkstra.relaxations");
+		
+		pq.push({dist[v], v});
+		STAT_COUNT("dijkstra.heap_pushes");
+		
+		/* if `v` is not already present in pq, simply push it
+	     * else
+		 *     1. either update the value (not doable with this data structure)
+		 *     2. reinsert in priority queue ( Accepted approach )
+		 */
+      }
+    }
+  }
+}
+
+/*
+ Dynamic updates : after shortest_path(src), update_edge() changes the
+ weight of an edge and repairs `dist` and `parent` instead of running
+ Dijkstra again over the whole graph (Ramalingam-Reps style).
+
+ Decrease : only vertices reachable through the cheaper edge can improve,
+ so the tail of the edge is put back in the priority queue and Dijkstra
+ continues from there, stopping where nothing improves any more.
+
+ Increase : only matters if the edge is in the shortest path tree. Then the
+ subtree below it loses its distances. Each vertex of the subtree gets the
+ best distance through its incoming edges from outside the subtree, and
+ Dijkstra continues from those vertices.
+
+ A batch does all the increases first, then all the decreases, and repairs
+ once. Weights must stay non negative.
+*/
+
+// sets the weight of every u -> v edge in `edges` of u, returns the
+// smallest old weight, or INT_MAX if there was no such edge
+inline int Graph::set_weight(lpii &edges, int v, int w) {
+  int old = INT_MAX;
+  for (auto &x : edges) {
+    if (x.first == v) {
+      old = x.second < old ? x.second : old;
+      x.second = w;
+    }
+  }
+  return old;
+}
+
+inline void Graph::update_edge(int u, int v, int w) {
+  update_edges(std::vector<EdgeUpdate>{EdgeUpdate{u, v, w}});
+}
+
+inline void Graph::update_edges(const std::vector<EdgeUpdate> &updates) {
+
+  STAT_PHASE("dijkstra.update_edges");
+
+  bool undirected = graphType.compare("undirected") == 0;
+
+  std::vector<int> roots; // subtrees that lost their distances
+  std::vector<int> tails; // tails of cheaper edges, to relax again
+
+  for (const EdgeUpdate &e : updates) {
+    int old = set_weight(adjList[e.u], e.v, e.w);
+    if (undirected) {
+      set_weight(adjList[e.v], e.u, e.w);
+    } else {
+      set_weight(inList[e.v], e.u, e.w);
+    }
+    if (old == INT_MAX) {
+      add_edge(e.u, e.v, e.w); // a new edge is a decrease from infinity
+    }
+
+    if (source == -1) {
+      continue;
+    }
+    if (e.w < old) {
+      tails.push_back(e.u);
+      if (undirected) {
+        tails.push_back(e.v);
+      }
+    } else if (e.w > old) {
+      if (parent[e.v] == e.u) {
+        roots.push_back(e.v);
+      }
+      if (undirected && parent[e.u] == e.v) {
+        roots.push_back(e.u);
+      }
+    }
+  }
+
+  if (source == -1) {
+    return;
+  }
+
+  // collect the subtrees below the increased tree edges
+  affected.resize(V, false);
+  std::vector<int> subtree;
+  std::vector<int> stack = roots;
+  while (!stack.empty()) {
+    int x = stack.back();
+    stack.pop_back();
+    if (affected[x]) {
+      continue;
+    }
+    affected[x] = true;
+    subtree.push_back(x);
+    for (auto &y : adjList[x]) {
+      if (parent[y.first] == x && !affected[y.first]) {
+        stack.push_back(y.first);
+      }
+    }
+  }
+  STAT_ADD("dijkstra.update_affected", subtree.size());
+
+  struct comparer{
+  	bool operator()(const pii& a, const pii& b) { return a.first > b.first; }
+  };
+  std::priority_queue<pii, std::vector<pii>, comparer> pq;
+
+  for (int x : subtree) {
+    dist[x] = INT_MAX;
+    parent[x] = -1;
+  }
+
+  // best way into the subtree from the part of the tree that is still valid
+  for (int x : subtree) {
+    for (auto &y : inList[x]) {
+      int from = y.first;
+      if (!affected[from] && dist[from] != INT_MAX &&
+          dist[from] + y.second < dist[x]) {
+        dist[x] = dist[from] + y.second;
+        parent[x] = from;
+      }
+    }
+    if (dist[x] != INT_MAX) {
+      pq.push({dist[x], x});
+    }
+  }
+
+  for (int x : subtree) {
+    affected[x] = false;
+  }
+
+  for (int x : tails) {
+    if (dist[x] != INT_MAX) {
+      pq.push({dist[x], x});
+    }
+  }
+
+  // Dijkstra from the seeded vertices, a vertex can come out of the queue
+  // again only if its distance improved in between
+  while (!pq.empty()) {
+    int d = pq.top().first;
+    int u = pq.top().second;
+    pq.pop();
+    if (d > dist[u]) {
+      STAT_COUNT("dijkstra.stale_pops");
+      continue;
+    }
+
+    for (auto &x : adjList[u]) {
+      int v = x.first;
+      int w = x.second;
+      if (dist[u] + w < dist[v]) {
+        dist[v] = dist[u] + w;
+        parent[v] = u;
+        STAT_COUNT("dijkstra.relaxations");
+        pq.push({dist[v], v});
+      }
+    }
+  }
+}
+
+// prints the result of the last shortest_path() call
+inline void Graph::print_paths() {
+  std::cout << std::setw(8) << "Vertex" << std::setw(8) << "Cost";
+  std::cout << std::setw(8) << "Path";
+  std::cout << "\n";
+  for (int i = 0; i < V; i++) {
+    std::cout << std::setw(6) << i << std::setw(9) << dist[i];
+    std::cout << std::setw(6);
+    print_path(i);
+    std::cout << "\n";
+  }
+}
+
+} // namespace dijkstra
+
+#endif
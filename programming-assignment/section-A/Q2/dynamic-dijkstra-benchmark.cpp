@@ -0,0 +1,137 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -O2
+ *
+ * Objective : Check Graph::update_edges() against a full recomputation on
+ *             random update sequences, and time both
+ *
+ * Usage :
+ *   dynamic-dijkstra-benchmark [V] [batches] [batch size] [seed] [directed]
+ *
+ * A random graph with 4V edges gets `batches` batches of random weight
+ * changes (increases and decreases). After every batch the repaired
+ * distances must equal those of shortest_path() run from scratch, and
+ * every parent must lie on a shortest path.
+ *
+ */
+
+#include <algorithm>        // sort
+#include <cstdlib>          // atoi, strtoull
+#include <cstring>          // strcmp
+#include <iomanip>          // setw, setprecision
+#include <iostream>         // cout, cerr
+#include <vector>           // vector
+
+#include "../benchmark/bench.h"
+#include "../benchmark/generators.h"
+#include "dijkstra-shortest-path.h"
+
+using namespace std;
+using namespace dijkstra;
+
+// every vertex except the source must be reached through an edge of its
+// parent that is exactly as long as the difference of their distances
+static bool validTree(const vector<int> &dist, const vector<int> &parent,
+                      const vector<vector<pii>> &weight, int src) {
+  for (size_t v = 0; v < dist.size(); ++v) {
+    if ((int)v == src || dist[v] == INT_MAX) {
+      continue;
+    }
+    int p = parent[v];
+    if (p < 0) {
+      return false;
+    }
+    bool found = false;
+    for (auto &x : weight[p]) {
+      found = found || (x.first == (int)v && dist[p] + x.second == dist[v]);
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static double median(vector<double> t) {
+  sort(t.begin(), t.end());
+  return t.empty() ? 0 : t[t.size() / 2];
+}
+
+int main(int argc, char *argv[]) {
+
+  int V = argc >= 2 ? atoi(argv[1]) : 100000;
+  int batches = argc >= 3 ? atoi(argv[2]) : 50;
+  int batchSize = argc >= 4 ? atoi(argv[3]) : 300;
+  uint64_t seed = argc >= 5 ? strtoull(argv[4], nullptr, 10) : 1;
+  bool directed = argc >= 6 && strcmp(argv[5], "directed") == 0;
+  const char *type = directed ? "directed" : "undirected";
+  const int maxW = 1000;
+  const int src = 0;
+
+  Rng rng(seed);
+  vector<Edge> edges = randomGraph(V, 4LL * V, maxW, rng);
+
+  // g is repaired, full is recomputed from scratch after every batch
+  Graph g(V, type), full(V, type);
+  for (const Edge &e : edges) {
+    g.add_edge(e.u, e.v, e.w);
+    full.add_edge(e.u, e.v, e.w);
+  }
+  g.shortest_path(src);
+  full.shortest_path(src);
+
+  // current weight of every edge, to check the parents
+  vector<vector<pii>> weight(V);
+
+  vector<double> repairTime, fullTime;
+  for (int b = 0; b < batches; ++b) {
+    vector<EdgeUpdate> batch;
+    for (int k = 0; k < batchSize; ++k) {
+      Edge &e = edges[rng() % edges.size()];
+      e.w = randomBetween(rng, 1, maxW);
+      batch.push_back(EdgeUpdate{e.u, e.v, e.w});
+    }
+
+    Clock::time_point start = Clock::now();
+    g.update_edges(batch);
+    repairTime.push_back(secondsSince(start));
+
+    full.update_edges(batch); // only to apply the new weights
+    start = Clock::now();
+    full.shortest_path(src);
+    fullTime.push_back(secondsSince(start));
+
+    for (auto &w : weight) {
+      w.clear();
+    }
+    for (const Edge &e : edges) {
+      weight[e.u].push_back({e.v, e.w});
+      if (!directed) {
+        weight[e.v].push_back({e.u, e.w});
+      }
+    }
+
+    if (g.distances() != full.distances() ||
+        !validTree(g.distances(), g.parents(), weight, src)) {
+      cerr << "Error : repaired tree differs from recomputation after batch "
+           << b + 1 << "\n";
+      return 1;
+    }
+  }
+
+  double repair = median(repairTime), recompute = median(fullTime);
+  cout << fixed << setprecision(3);
+  cout << "graph                 : " << type << ", V = " << V
+       << ", E = " << edges.size() << "\n";
+  cout << "batches x size        : " << batches << " x " << batchSize << "\n";
+  cout << "all batches match full recomputation\n";
+  cout << "median repair (ms)    : " << repair * 1e3 << "\n";
+  cout << "median recompute (ms) : " << recompute * 1e3 << "\n";
+  cout << "per update (us)       : " << repair * 1e6 / batchSize << "\n";
+  cout << "speedup               : " << recompute / repair << "\n";
+  return 0;
+}
@@ -9,6 +9,9 @@
  */
 
 #include <iostream>
+
+#include "NQueens.h"
+
 using namespace std;
 
 void printSolution(int **board, int N, int solNo) {
@@ -37,26 +40,6 @@ void printSolution(int **board, int N, int solNo) {
   
 }
 
-bool isSafe(int **board, int N, int row, int col) {
-
-  // Check this row on left side
-  for (int i = 0; i < col; i++)
-    if (board[row][i])
-      return false;
-
-  // Check upper diagonal on left side
-  for (int i = row, j = col; i >= 0 && j >= 0; i--, j--)
-    if (board[i][j])
-      return false;
-
-  // Check lower diagonal on left side
-  for (int i = row, j = col; i < N && j >= 0; i++, j--)
-    if (board[i][j])
-      return false;
-
-  return true;
-}
-
 bool NQueenHelper(int **board, int N, int col, int &solNo) {
 
   if (col == N) {
@@ -0,0 +1,89 @@
+/*
+ * Author : Jatin Rohilla, moved into this header by agent (Oct-2026)
+ * Date   : Nov-2018
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : N Queen's problem using Back Tracking
+ * Major Inputs  : Board size N
+ * Major Outputs : Number of ways to place N non-attacking queens
+ *
+ * Queens are placed column by column, board[row][col] is 1 for a queen.
+ *
+ */
+
+#ifndef NQUEENS_H
+#define NQUEENS_H
+
+// benchmark/stats-overhead.cpp keeps a copy of this solver without the
+// STAT_ lines (plainCountNQueen), a change here has to be made there too.
+#include "../benchmark/stats.h"
+
+inline bool isSafe(int **board, int N, int row, int col) {
+
+  STAT_COUNT("nqueens.isSafe_calls");
+
+  // Check this row on left side
+  for (int i = 0; i < col; i++)
+    if (board[row][i])
+      return false;
+
+  // Check upper diagonal on left side
+  for (int i = row, j = col; i >= 0 && j >= 0; i--, j--)
+    if (board[i][j])
+      return false;
+
+  // Check lower diagonal on left side
+  for (int i = row, j = col; i < N && j >= 0; i++, j--)
+    if (board[i][j])
+      return false;
+
+  return true;
+}
+
+// counts the solutions that complete a board filled up to column `col`
+inline long long countNQueenHelper(int **board, int N, int col) {
+
+  if (col == N) {
+    return 1;
+  }
+
+  long long count = 0;
+  for (int row = 0; row < N; row++) {
+    // check at board[i][col]
+    if (isSafe(board, N, row, col)) {
+      board[row][col] = 1;
+      count += countNQueenHelper(board, N, col + 1);
+      board[row][col] = 0; // backtrack
+    }
+  }
+
+  return count;
+}
+
+// Non interactive : returns the number of solutions for an N x N board
+inline long long countNQueen(int N) {
+
+  STAT_PHASE("nqueens.count");
+
+  // allocate board
+  int **board = new int *[N];
+  for (int i = 0; i < N; i++) {
+    board[i] = new int[N]{0};
+  }
+
+  int startingCol = 0;
+  long long noOfSolutions = countNQueenHelper(board, N, startingCol);
+
+  // de-allocate board
+  for (int i = 0; i < N; ++i) {
+    delete[] board[i];
+  }
+  delete[] board;
+
+  return noOfSolutions;
+}
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -O2
+ *
+ * Objective : Count the N-Queens solutions of large boards in pieces that
+ *             survive a killed job
+ *
+ * Usage :
+ *   nqueens-shards units  <N> [--depth d]
+ *   nqueens-shards run    <N> <results file> [--depth d] [--shard i/k]
+ *   nqueens-shards launch <N> <results prefix> <workers> [--depth d]
+ *   nqueens-shards merge  <N> <results files ...> [--depth d]
+ *   nqueens-shards verify [max N] [--depth d]
+ *
+ * run     solves the units i, i+k, i+2k ... that are not yet in the results
+ *         file, appending each one as it finishes. Run it again after a
+ *         kill and it goes on from where it stopped.
+ * launch  starts `workers` run processes, worker i writing to
+ *         <prefix>.<i>, waits for them and merges.
+ * merge   adds up the units of all the files, and lists the missing units
+ *         if there are any.
+ * verify  counts every board up to max N (12 by default) in units and
+ *         checks the totals against the known counts (up to N = 18).
+ *
+ * The depth (3 by default) must be the same for every command of a job.
+ *
+ */
+
+#include <cerrno>           // errno, ERANGE
+#include <climits>          // INT_MAX
+#include <cstdlib>          // strtol
+#include <cstring>          // strcmp
+#include <iostream>         // cout, cerr
+#include <string>           // string, to_string
+#include <vector>           // vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>       // waitpid
+#include <unistd.h>         // fork, execlp
+#define HAVE_FORK 1
+#endif
+
+#include "../benchmark/bench.h"
+#include "nqueens-shards.h"
+
+using namespace std;
+
+// no of solutions for N = 0..18 (OEIS A000170)
+static const long long knownCounts[] = {
+    1,       1,        0,         0,          2,
+    10,      4,        40,        92,         352,
+    724,     2680,     14200,     73712,      365596,
+    2279184, 14772512, 95815104,  666090624};
+
+// the non negative number in s, -1 if s is not one
+static int toCount(const string &s) {
+  char *end = nullptr;
+  errno = 0;
+  long v = strtol(s.c_str(), &end, 10);
+  if (s.empty() || *end != '\0' || errno == ERANGE || v < 0 || v > INT_MAX) {
+    return -1;
+  }
+  return v;
+}
+
+static int depthOption(int argc, char *argv[]) {
+  for (int i = 1; i + 1 < argc; ++i) {
+    if (strcmp(argv[i], "--depth") == 0) {
+      return toCount(argv[i + 1]);
+    }
+  }
+  return 3;
+}
+
+// arguments that are not options
+static vector<string> positional(int argc, char *argv[]) {
+  vector<string> args;
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], "--", 2) == 0) {
+      ++i; // skip its value
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+  return args;
+}
+
+static void usage() {
+  cerr << "Usage :\n"
+       << "  nqueens-shards units  <N> [--depth d]\n"
+       << "  nqueens-shards run    <N> <results file> [--depth d] "
+          "[--shard i/k]\n"
+       << "  nqueens-shards launch <N> <results prefix> <workers> "
+          "[--depth d]\n"
+       << "  nqueens-shards merge  <N> <results files ...> [--depth d]\n"
+       << "  nqueens-shards verify [max N] [--depth d]\n";
+}
+
+static int run(int N, int depth, const string &path, int shard, int shards) {
+  vector<WorkUnit> units = makeWorkUnits(N, depth);
+  ShardResults results(N, depth, units.size());
+  results.load(path);
+  results.open(path);
+
+  size_t skipped = 0, solved = 0;
+  Clock::time_point start = Clock::now();
+  for (size_t u = shard; u < units.size(); u += shards) {
+    if (results.results().count(u)) {
+      skipped++;
+      continue;
+    }
+    results.add(u, countWorkUnit(N, units[u]));
+    solved++;
+  }
+  cout << "shard " << shard << "/" << shards << " : " << solved
+       << " units solved, " << skipped << " already done, "
+       << secondsSince(start) << " s\n";
+  return 0;
+}
+
+static int merge(int N, int depth, const vector<string> &paths) {
+  size_t noOfUnits = makeWorkUnits(N, depth).size();
+  ShardResults results(N, depth, noOfUnits);
+  for (const string &path : paths) {
+    results.load(path);
+  }
+
+  vector<size_t> missing;
+  long long total = 0;
+  for (size_t u = 0; u < noOfUnits; ++u) {
+    auto it = results.results().find(u);
+    if (it == results.results().end()) {
+      missing.push_back(u);
+    } else {
+      total += it->second;
+    }
+  }
+
+  if (!missing.empty()) {
+    cerr << "Error : " << missing.size() << " of " << noOfUnits
+         << " units missing :";
+    for (size_t i = 0; i < missing.size() && i < 20; ++i) {
+      cerr << " " << missing[i];
+    }
+    cerr << (missing.size() > 20 ? " ...\n" : "\n");
+    return 1;
+  }
+  cout << "Total no of Solutions for N = " << N << " : " << total << "\n";
+  return 0;
+}
+
+static int launch(const char *self, int N, int depth, const string &prefix,
+                  int workers) {
+#ifdef HAVE_FORK
+  vector<string> paths;
+  vector<pid_t> children;
+  for (int i = 0; i < workers; ++i) {
+    paths.push_back(prefix + "." + to_string(i));
+    pid_t pid = fork();
+    if (pid < 0) {
+      cerr << "Error : could not start worker " << i << "\n";
+      return 1;
+    }
+    if (pid == 0) {
+      string n = to_string(N), d = to_string(depth),
+             shard = to_string(i) + "/" + to_string(workers);
+      execlp(self, self, "run", n.c_str(), paths.back().c_str(), "--depth",
+            d.c_str(), "--shard", shard.c_str(), (char *)nullptr);
+      _exit(127);
+    }
+    children.push_back(pid);
+  }
+
+  bool failed = false;
+  for (pid_t pid : children) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    failed = failed || !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+  }
+  if (failed) {
+    cerr << "Error : a worker failed, launch again to resume\n";
+    return 1;
+  }
+  return merge(N, depth, paths);
+#else
+  (void)self, (void)N, (void)depth, (void)prefix, (void)workers;
+  cerr << "Error : launch needs fork(), start the run workers by hand\n";
+  return 1;
+#endif
+}
+
+static int verify(int maxN, int depth) {
+  bool ok = true;
+  for (int N = 1; N <= maxN; ++N) {
+    long long total = 0;
+    for (const WorkUnit &unit : makeWorkUnits(N, depth)) {
+      total += countWorkUnit(N, unit);
+    }
+    cout << "N = " << N << " : " << total;
+    if (total != knownCounts[N]) {
+      cout << "  MISMATCH, expected " << knownCounts[N];
+      ok = false;
+    }
+    cout << "\n";
+  }
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char *argv[]) {
+
+  vector<string> args = positional(argc, argv);
+  int depth = depthOption(argc, argv);
+  if (args.empty() || depth < 0) {
+    usage();
+    return 1;
+  }
+  const string &cmd = args[0];
+
+  try {
+    if (cmd == "verify") {
+      int maxN = args.size() >= 2 ? toCount(args[1]) : 12;
+      if (maxN < 0) {
+        cerr << "Error : " << args[1] << " is not a number\n";
+        return 1;
+      }
+      if (maxN < 1 || maxN > 18) {
+        cerr << "Error : known counts go up to N = 18\n";
+        return 1;
+      }
+      return verify(maxN, depth);
+    }
+
+    if (args.size() < 2) {
+      usage();
+      return 1;
+    }
+    int N = toCount(args[1]);
+    if (N < 0) {
+      cerr << "Error : " << args[1] << " is not a number\n";
+      return 1;
+    }
+    if (N < 1 || N > 32) {
+      cerr << "Error : N must be in 1..32\n";
+      return 1;
+    }
+
+    if (cmd == "units") {
+      cout << makeWorkUnits(N, depth).size() << "\n";
+      return 0;
+    }
+
+    if (cmd == "run" && args.size() == 3) {
+      int shard = 0, shards = 1;
+      for (int i = 1; i + 1 < argc; ++i) {
+        if (strcmp(argv[i], "--shard") != 0) {
+          continue;
+        }
+        string value = argv[i + 1];
+        size_t slash = value.find('/');
+        shard = toCount(value.substr(0, slash));
+        shards = slash == string::npos ? -1 : toCount(value.substr(slash + 1));
+        if (shards < 1 || shard < 0 || shard >= shards) {
+          cerr << "Error : --shard takes i/k with 0 <= i < k\n";
+          return 1;
+        }
+      }
+      return run(N, depth, args[2], shard, shards);
+    }
+
+    if (cmd == "launch" && args.size() == 4) {
+      int workers = toCount(args[3]);
+      if (workers < 0) {
+        cerr << "Error : " << args[3] << " is not a number\n";
+        return 1;
+      }
+      if (workers < 1) {
+        cerr << "Error : need at least one worker\n";
+        return 1;
+      }
+      return launch(argv[0], N, depth, args[2], workers);
+    }
+
+    if (cmd == "merge" && args.size() >= 3) {
+      return merge(N, depth, vector<string>(args.begin() + 2, args.end()));
+    }
+  } catch (const char *msg) {
+    cerr << msg << "\n";
+    return 1;
+  }
+
+  usage();
+  return 1;
+}
@@ -0,0 +1,214 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Split the N-Queens count into work units that can be
+ *                 solved separately, checkpointed and merged
+ * Major Inputs  : Board size N, prefix depth d
+ * Major Outputs : Work units, the count of each, the merged total
+ *
+ * A work unit is a safe placement of the queens of the first d columns.
+ * The units are numbered in the order the backtracking of NQueenHelper()
+ * would reach them (column by column, rows top to bottom), so the same
+ * N and d always give the same units, in every process.
+ *
+ * Every unit is finished by backtracking over the remaining columns, with
+ * the rows and diagonals in use kept as bit masks : isSafe() is an O(N)
+ * scan of the board, the masks answer the same question in O(1).
+ *
+ * Results are appended to a text file, one line per finished unit :
+ *
+ *     nqueens <N> <d> <no of units>       header, once
+ *     <unit> <count>                      one per unit
+ *
+ * A unit is only counted once its line (with the newline) is on disk, so
+ * a killed worker loses at most the unit it was working on.
+ *
+ */
+
+#ifndef NQUEENS_SHARDS_H
+#define NQUEENS_SHARDS_H
+
+#include <cstdint>          // uint32_t
+#include <cstdio>           // FILE, fopen, fprintf
+#include <fstream>          // ifstream, ofstream
+#include <iterator>         // istreambuf_iterator
+#include <map>              // map
+#include <sstream>          // istringstream
+#include <string>           // string
+#include <vector>           // vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>         // fsync
+#endif
+
+typedef std::vector<int> WorkUnit; // row of the queen in each of the first d columns
+
+// Queens so far as bit masks, bit r is row r
+struct QueenMasks {
+  uint32_t rows;  // rows in use
+  uint32_t down;  // diagonals going down-right, shifted into the next column
+  uint32_t up;    // diagonals going up-right, shifted into the next column
+};
+
+inline uint32_t freeRows(int N, const QueenMasks &m) {
+  uint32_t all = N == 32 ? 0xffffffffu : ((1u << N) - 1);
+  return all & ~(m.rows | m.down | m.up);
+}
+
+inline QueenMasks placeQueen(const QueenMasks &m, uint32_t bit) {
+  return QueenMasks{m.rows | bit, (m.down | bit) << 1, (m.up | bit) >> 1};
+}
+
+// no of ways to fill columns col..N-1
+inline long long countFrom(int N, int col, const QueenMasks &m) {
+  if (col == N) {
+    return 1;
+  }
+  long long count = 0;
+  uint32_t free = freeRows(N, m);
+  while (free) {
+    uint32_t bit = free & (~free + 1); // lowest free row
+    free ^= bit;
+    count += countFrom(N, col + 1, placeQueen(m, bit));
+  }
+  return count;
+}
+
+inline void collectUnits(int N, int depth, int col, const QueenMasks &m,
+                         WorkUnit &prefix, std::vector<WorkUnit> &units) {
+  if (col == depth) {
+    units.push_back(prefix);
+    return;
+  }
+  uint32_t free = freeRows(N, m);
+  for (int row = 0; row < N; ++row) {
+    uint32_t bit = 1u << row;
+    if (free & bit) {
+      prefix.push_back(row);
+      collectUnits(N, depth, col + 1, placeQueen(m, bit), prefix, units);
+      prefix.pop_back();
+    }
+  }
+}
+
+// All safe placements of the first `depth` columns, in backtracking order
+inline std::vector<WorkUnit> makeWorkUnits(int N, int depth) {
+  depth = depth < N ? depth : N;
+  std::vector<WorkUnit> units;
+  WorkUnit prefix;
+  collectUnits(N, depth, 0, QueenMasks{0, 0, 0}, prefix, units);
+  return units;
+}
+
+// no of solutions that start with the placements of `unit`
+inline long long countWorkUnit(int N, const WorkUnit &unit) {
+  QueenMasks m{0, 0, 0};
+  for (int row : unit) {
+    m = placeQueen(m, 1u << row);
+  }
+  return countFrom(N, unit.size(), m);
+}
+
+// The results file of one worker
+class ShardResults {
+
+private:
+  int N, depth;
+  size_t noOfUnits;
+  std::map<size_t, long long> counts;
+  FILE *out;
+
+public:
+  ShardResults(int _N, int _depth, size_t _noOfUnits)
+      : N(_N), depth(_depth), noOfUnits(_noOfUnits), out(nullptr) {}
+  ~ShardResults() {
+    if (out) {
+      fclose(out);
+    }
+  }
+
+  const std::map<size_t, long long> &results() const { return counts; }
+
+  // Reads the finished units of `path`, a missing file has none.
+  // An incomplete last line (worker killed while writing) is ignored.
+  // Throws if the file belongs to another N or depth.
+  void load(const std::string &path) {
+    std::ifstream iob(path, std::ios::binary);
+    if (!iob) {
+      return;
+    }
+    std::string content((std::istreambuf_iterator<char>(iob)),
+                        std::istreambuf_iterator<char>());
+    std::istringstream lines(content.substr(0, content.rfind('\n') + 1));
+
+    std::string line;
+    bool header = true;
+    while (getline(lines, line)) {
+      std::istringstream fields(line);
+      if (header) {
+        std::string tag;
+        int n, d;
+        size_t u;
+        if (!(fields >> tag >> n >> d >> u) || tag != "nqueens" || n != N ||
+            d != depth || u != noOfUnits) {
+          throw "Error : results file is for another board or depth";
+        }
+        header = false;
+        continue;
+      }
+      size_t unit;
+      long long count;
+      if (!(fields >> unit >> count) || unit >= noOfUnits) {
+        throw "Error : results file is damaged";
+      }
+      if (counts.count(unit) && counts[unit] != count) {
+        throw "Error : results files disagree on a unit";
+      }
+      counts[unit] = count;
+    }
+  }
+
+  // opens `path` to append results, writing the header if it is new.
+  // Half a line left by a killed worker is cut off first.
+  void open(const std::string &path) {
+    std::string content;
+    {
+      std::ifstream iob(path, std::ios::binary);
+      content.assign(std::istreambuf_iterator<char>(iob),
+                     std::istreambuf_iterator<char>());
+    }
+    if (!content.empty() && content.back() != '\n') {
+      size_t keep = content.rfind('\n');
+      keep = keep == std::string::npos ? 0 : keep + 1;
+      std::ofstream rewrite(path, std::ios::binary | std::ios::trunc);
+      rewrite.write(content.data(), keep);
+      content.resize(keep);
+    }
+
+    out = fopen(path.c_str(), "ab");
+    if (!out) {
+      throw "Error : could not open results file";
+    }
+    if (content.empty()) {
+      fprintf(out, "nqueens %d %d %zu\n", N, depth, noOfUnits);
+      fflush(out);
+    }
+  }
+
+  // appends one finished unit and makes sure it is on disk
+  void add(size_t unit, long long count) {
+    counts[unit] = count;
+    fprintf(out, "%zu %lld\n", unit, count);
+    fflush(out);
+#if defined(__unix__) || defined(__APPLE__)
+    fsync(fileno(out));
+#endif
+  }
+};
+
+#endif
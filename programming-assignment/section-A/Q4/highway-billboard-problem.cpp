@@ -9,41 +9,10 @@
  */
 
 #include <iostream>
-using namespace std;
-
-int billboardConst(int M, int n, int x, int position[], int revenue[]) {
-
-  // store revenue at each mile
-  int maxRev[M + 1]{0};
-
-  int next = 0;
-  for (int i = 1; i <= M; i++) {
-
-    // check if all billboards are already placed.
-    if (next < n) {
 
-      // check if we have billboard at this position
-      // If not, simply used the previous value
-      if (position[next] != i) {
-        maxRev[i] = maxRev[i - 1];
-      } else {
+#include "highway-billboard-problem.h"
 
-        // if current pos <= x, then we can have only one billboard.
-        if (i <= x) {
-          maxRev[i] = max(maxRev[i - 1], revenue[next]);
-        } else {
-          // place next bill board, or, not place it
-          maxRev[i] = max(maxRev[i - x - 1] + revenue[next], maxRev[i - 1]);
-        }
-        next++;
-      }
-    } else {
-      maxRev[i] = maxRev[i - 1];
-    }
-  }
-
-  return maxRev[M];
-}
+using namespace std;
 
 int main() {
 
@@ -0,0 +1,64 @@
+/*
+ * Author : Jatin Rohilla, moved into this header by agent (Oct-2026)
+ * Date   : Nov-2018
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Highway Billboard Problem
+ * Major Inputs  : Highway length M, min distance x, and n billboard sites
+ *                 sorted by position (1..M) with their revenues
+ * Major Outputs : Maximum total revenue
+ *
+ */
+
+#ifndef HIGHWAY_BILLBOARD_PROBLEM_H
+#define HIGHWAY_BILLBOARD_PROBLEM_H
+
+#include <algorithm>        // max
+#include <vector>           // vector
+
+// benchmark/stats-overhead.cpp keeps a copy of this solver without the
+// STAT_ lines (plainBillboard), a change here has to be made there too.
+#include "../benchmark/stats.h"
+
+inline int billboardConst(int M, int n, int x, const int position[],
+                          const int revenue[]) {
+
+  STAT_PHASE("billboard.total");
+
+  // store revenue at each mile
+  std::vector<int> maxRev(M + 1, 0);
+
+  int next = 0;
+  for (int i = 1; i <= M; i++) {
+    STAT_COUNT("billboard.dp_cells");
+
+    // check if all billboards are already placed.
+    if (next < n) {
+
+      // check if we have billboard at this position
+      // If not, simply used the previous value
+      if (position[next] != i) {
+        maxRev[i] = maxRev[i - 1];
+      } else {
+
+        // if current pos <= x, then we can have only one billboard.
+        if (i <= x) {
+          maxRev[i] = std::max(maxRev[i - 1], revenue[next]);
+        } else {
+          // place next bill board, or, not place it
+          maxRev[i] = std::max(maxRev[i - x - 1] + revenue[next], maxRev[i - 1]);
+        }
+        next++;
+      }
+    } else {
+      maxRev[i] = maxRev[i - 1];
+    }
+  }
+
+  return maxRev[M];
+}
+
+#endif
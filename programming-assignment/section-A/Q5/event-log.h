@@ -0,0 +1,294 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Read an event log without one heap allocation per event
+ * Major Inputs  : Path of a text file, one event per line
+ * Major Outputs : Log as a dense array of integer event IDs + a dictionary
+ *
+ * The file is memory mapped and split into lines in place. Every line is
+ * interned into an EventDictionary, so equal events get equal IDs and the
+ * matchers can compare integers instead of strings.
+ *
+ * Memory used is 4 bytes per event + the size of the distinct events,
+ * the file itself is only paged in while it is being tokenized.
+ *
+ */
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <cstdint>          // uint32_t, uint64_t
+#include <cstring>          // memchr, memcmp
+#include <fstream>          // ifstream (fallback reader)
+#include <string>           // string
+#include <vector>           // vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EVENT_LOG_HAS_MMAP 1
+#include <fcntl.h>          // open
+#include <sys/mman.h>       // mmap, madvise, munmap
+#include <sys/stat.h>       // fstat
+#include <unistd.h>         // close
+#endif
+
+typedef uint32_t EventId;
+
+// Read-only view of a whole file.
+// Uses mmap where available, else falls back to reading the file in memory.
+class MappedFile {
+
+private:
+  const char *base;
+  size_t length;
+  bool mapped;
+  std::vector<char> buffer; // used only by the fallback reader
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+  MappedFile() : base(nullptr), length(0), mapped(false) {}
+  ~MappedFile() { close(); }
+
+  bool open(const char *path) {
+    close();
+
+#ifdef EVENT_LOG_HAS_MMAP
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      ::close(fd);
+      return false;
+    }
+    length = st.st_size;
+    if (length == 0) {
+      ::close(fd);
+      return true;
+    }
+    void *p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // mapping stays valid after the descriptor is closed
+    if (p == MAP_FAILED) {
+      length = 0;
+      return false;
+    }
+    madvise(p, length, MADV_SEQUENTIAL);
+    base = static_cast<const char *>(p);
+    mapped = true;
+    return true;
+#else
+    std::ifstream iob(path, std::ios::binary | std::ios::ate);
+    if (!iob) {
+      return false;
+    }
+    buffer.resize(static_cast<size_t>(iob.tellg()));
+    iob.seekg(0);
+    iob.read(buffer.data(), buffer.size());
+    base = buffer.data();
+    length = buffer.size();
+    return true;
+#endif
+  }
+
+  void close() {
+#ifdef EVENT_LOG_HAS_MMAP
+    if (mapped) {
+      munmap(const_cast<char *>(base), length);
+    }
+#endif
+    std::vector<char>().swap(buffer);
+    base = nullptr;
+    length = 0;
+    mapped = false;
+  }
+
+  const char *data() const { return base; }
+  size_t size() const { return length; }
+
+  // tells the OS the first `upto` bytes are not needed any more, so they
+  // stop counting towards resident memory. They can still be read again.
+  void release(size_t upto) {
+#ifdef EVENT_LOG_HAS_MMAP
+    size_t page = sysconf(_SC_PAGESIZE);
+    upto -= upto % page;
+    if (mapped && upto) {
+      madvise(const_cast<char *>(base), upto, MADV_DONTNEED);
+    }
+#endif
+  }
+};
+
+// Calls f(begin, len) for every line in [begin, end).
+// Same splitting as getline : a trailing newline does not make an extra
+// empty line. A '\r' before the newline is dropped so CRLF files work too.
+template <typename F>
+void forEachLine(const char *begin, const char *end, F f) {
+  const char *p = begin;
+  while (p < end) {
+    const char *nl = static_cast<const char *>(memchr(p, '\n', end - p));
+    const char *lineEnd = nl ? nl : end;
+    size_t len = lineEnd - p;
+    if (len && p[len - 1] == '\r') {
+      len--;
+    }
+    f(p, len);
+    p = nl ? nl + 1 : end;
+  }
+}
+
+// Maps every distinct event string to a dense ID : 0, 1, 2 ...
+// Open addressing hash table, strings are kept in a single arena.
+class EventDictionary {
+
+private:
+  std::vector<char> arena;        // all distinct event strings back to back
+  std::vector<uint64_t> offsets;  // offsets[id] .. offsets[id+1] is event id
+  std::vector<EventId> slots;     // hash table of ids, EMPTY if unused
+  std::vector<uint32_t> hashes;   // hash of each id, avoids re-hashing
+  size_t mask;
+
+  enum : EventId { EMPTY = UINT32_MAX };
+
+  static uint32_t hashOf(const char *s, size_t len) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+      h ^= static_cast<unsigned char>(s[i]);
+      h *= 16777619u;
+    }
+    return h;
+  }
+
+  bool equals(EventId id, const char *s, size_t len) const {
+    uint64_t from = offsets[id];
+    return offsets[id + 1] - from == len &&
+           (len == 0 || memcmp(arena.data() + from, s, len) == 0);
+  }
+
+  void grow() {
+    std::vector<EventId> bigger(slots.size() * 2, EMPTY);
+    size_t newMask = bigger.size() - 1;
+    for (EventId id = 0; id < hashes.size(); ++id) {
+      size_t i = hashes[id] & newMask;
+      while (bigger[i] != EMPTY) {
+        i = (i + 1) & newMask;
+      }
+      bigger[i] = id;
+    }
+    slots.swap(bigger);
+    mask = newMask;
+  }
+
+public:
+  enum : EventId { NOT_FOUND = UINT32_MAX };
+
+  EventDictionary() : offsets(1, 0), slots(1024, EMPTY), mask(1023) {}
+
+  size_t size() const { return hashes.size(); }
+
+  // returns the id of the event, adds it if it was not seen before
+  EventId intern(const char *s, size_t len) {
+    uint32_t h = hashOf(s, len);
+    size_t i = h & mask;
+    while (slots[i] != EMPTY) {
+      EventId id = slots[i];
+      if (hashes[id] == h && equals(id, s, len)) {
+        return id;
+      }
+      i = (i + 1) & mask;
+    }
+
+    EventId id = hashes.size();
+    slots[i] = id;
+    hashes.push_back(h);
+    arena.insert(arena.end(), s, s + len);
+    offsets.push_back(arena.size());
+
+    // keep load factor below 1/2
+    if (2 * hashes.size() > slots.size()) {
+      grow();
+    }
+    return id;
+  }
+
+  EventId intern(const std::string &s) { return intern(s.data(), s.size()); }
+
+  // returns the id of the event, or NOT_FOUND if it was never interned
+  EventId find(const char *s, size_t len) const {
+    uint32_t h = hashOf(s, len);
+    for (size_t i = h & mask; slots[i] != EMPTY; i = (i + 1) & mask) {
+      EventId id = slots[i];
+      if (hashes[id] == h && equals(id, s, len)) {
+        return id;
+      }
+    }
+    return NOT_FOUND;
+  }
+
+  std::string name(EventId id) const {
+    return std::string(arena.data() + offsets[id],
+                       arena.data() + offsets[id + 1]);
+  }
+
+  size_t memoryUsage() const {
+    return arena.capacity() + offsets.capacity() * sizeof(uint64_t) +
+           slots.capacity() * sizeof(EventId) +
+           hashes.capacity() * sizeof(uint32_t);
+  }
+};
+
+// Interns every line of the buffer and appends the ids to `events`.
+inline void tokenizeEvents(const char *begin, const char *end,
+                           EventDictionary &dict,
+                           std::vector<EventId> &events) {
+  forEachLine(begin, end, [&](const char *s, size_t len) {
+    events.push_back(dict.intern(s, len));
+  });
+}
+
+// Reads the whole file at `path` as a list of event ids.
+// returns false if the file could not be opened.
+inline bool readEventLog(const char *path, EventDictionary &dict,
+                         std::vector<EventId> &events) {
+  MappedFile file;
+  if (!file.open(path)) {
+    return false;
+  }
+  const char *begin = file.data();
+  const char *end = begin + file.size();
+
+  // estimate the number of lines from the first 1 MB, so the id array is
+  // allocated once instead of being doubled (and copied) while it grows
+  size_t sample = file.size() < (1u << 20) ? file.size() : (1u << 20);
+  size_t linesInSample = 1;
+  for (size_t i = 0; i < sample; ++i) {
+    linesInSample += (begin[i] == '\n');
+  }
+  double estimate = 1.05 * linesInSample * file.size() / (sample ? sample : 1);
+  events.reserve(events.size() + static_cast<size_t>(estimate));
+
+  // tokenize in blocks that end on a line boundary, dropping the pages of
+  // each block once it is done so a huge log is never resident at once
+  const size_t blockSize = 64u << 20;
+  const char *from = begin;
+  while (from < end) {
+    const char *to = (size_t)(end - from) > blockSize ? from + blockSize : end;
+    if (to < end) {
+      const char *nl = static_cast<const char *>(memchr(to, '\n', end - to));
+      to = nl ? nl + 1 : end;
+    }
+    tokenizeEvents(from, to, dict, events);
+    file.release(to - begin);
+    from = to;
+  }
+  return true;
+}
+
+#endif
@@ -8,54 +8,32 @@
  *
  */
 
-#include <fstream>
 #include <iostream>
-#include <string>
 #include <vector>
 
+#include "event-log.h"
+#include "subsequence.h"
 
 using namespace std;
 
-// checks if B is a subSequence of A
-bool isSubsequence(vector<string> B, vector<string> A) {
-
-  int m = A.size();
-  int n = B.size();
-
-  if (m < n) {
-    return false;
-  }
-
-  int j = 0;
-  for (int i = 0; i < m && j < n; ++i) {
-    if (A[i].compare(B[j]) == 0) {
-      j++;
-    }
-  }
-
-  return (j == n);
-}
-
 int main() {
 
-  ifstream iob;
-  string temp;
+  // both logs share one dictionary so equal events get equal ids
+  EventDictionary dict;
 
-  vector<string> A;
+  vector<EventId> A;
   cout << "\nReading events A from file ... ";
-  iob.open("eventsA.txt");
-  while (getline(iob, temp)) {
-    A.push_back(temp);
+  if (!readEventLog("eventsA.txt", dict, A)) {
+    cerr << "\nError : could not open eventsA.txt\n";
+    return 1;
   }
-  iob.close();
 
-  vector<string> B;
+  vector<EventId> B;
   cout << "\nReading events B from file ... ";
-  iob.open("eventsB.txt");
-  while (getline(iob, temp)) {
-    B.push_back(temp);
+  if (!readEventLog("eventsB.txt", dict, B)) {
+    cerr << "\nError : could not open eventsB.txt\n";
+    return 1;
   }
-  iob.close();
 
   if (isSubsequence(B, A)) {
     cout << "\n\nYes. List of events B is a subsequence of events A.\n";
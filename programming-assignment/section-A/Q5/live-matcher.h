@@ -0,0 +1,199 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Detect patterns in an event stream as the events arrive
+ * Major Inputs  : Patterns (registered / removed at any time), then events
+ *                 one at a time or in batches
+ * Major Outputs : A callback the moment a pattern completes
+ *
+ * Patterns without a window use the greedy scan : the state is a cursor
+ * into the pattern, and the pattern sits in the bucket of the event it
+ * waits for next (as in multi-pattern.h). An event only touches the
+ * patterns waiting for it.
+ *
+ * Patterns with a window of T events must complete within T events of
+ * their first matched event. The greedy cursor cannot do that, the
+ * earliest start it picks may be too far back while a later start would
+ * fit. So for these, start[j] keeps the latest position at which a match
+ * of the first j events can begin. An event e extends every prefix that
+ * ends just before an e, which costs one step per occurrence of e in the
+ * windowed patterns.
+ *
+ * After a pattern completes it starts over, so it fires again on the
+ * next complete occurrence after that.
+ *
+ */
+
+#ifndef LIVE_MATCHER_H
+#define LIVE_MATCHER_H
+
+#include <cstdint>
+#include <functional>       // function
+#include <vector>
+
+#include "event-log.h"
+
+typedef uint32_t PatternId;
+
+class LiveMatcher {
+
+public:
+  // called with the pattern and the no of events fed when it completed
+  typedef std::function<void(PatternId, uint64_t)> MatchCallback;
+
+private:
+  enum : uint64_t { NONE = UINT64_MAX };
+
+  struct Pattern {
+    std::vector<EventId> events;
+    uint64_t window;             // 0 : no window
+    bool active;
+    uint32_t cursor;             // greedy state, when there is no window
+    std::vector<uint64_t> start; // start[j], when there is a window
+  };
+
+  // an occurrence of an event in a windowed pattern
+  struct Step {
+    PatternId p;
+    uint32_t j; // B[j] is the event
+  };
+
+  std::vector<Pattern> patterns;
+  std::vector<std::vector<PatternId>> waiting; // greedy patterns by next event
+  std::vector<std::vector<Step>> steps;        // windowed steps by event
+  std::vector<PatternId> current;
+  std::vector<PatternId> fired;  // completed on the current event
+  uint64_t position;  // no of events fed so far
+  size_t noOfActive;
+  MatchCallback onMatch;
+
+  void ensureEvent(EventId e) {
+    if (e >= waiting.size()) {
+      waiting.resize(e + 1);
+      steps.resize(e + 1);
+    }
+  }
+
+public:
+  explicit LiveMatcher(MatchCallback callback)
+      : position(0), noOfActive(0), onMatch(callback) {}
+
+  // registers a pattern, returns its id. An empty pattern never fires.
+  PatternId addPattern(const std::vector<EventId> &events,
+                       uint64_t window = 0) {
+    PatternId p = patterns.size();
+    patterns.push_back(Pattern{events, window, true, 0, {}});
+    noOfActive++;
+
+    if (events.empty()) {
+      return p;
+    }
+    for (EventId e : events) {
+      ensureEvent(e);
+    }
+
+    if (window == 0) {
+      waiting[events[0]].push_back(p);
+    } else {
+      patterns[p].start.assign(events.size() + 1, NONE);
+      // last step first : one event must not extend two prefixes in a row
+      for (uint32_t j = events.size(); j-- > 0;) {
+        steps[events[j]].push_back(Step{p, j});
+      }
+    }
+    return p;
+  }
+
+  // stops a pattern from firing. Its bucket entries are dropped lazily.
+  bool removePattern(PatternId p) {
+    if (p >= patterns.size() || !patterns[p].active) {
+      return false;
+    }
+    patterns[p].active = false;
+    std::vector<EventId>().swap(patterns[p].events);
+    std::vector<uint64_t>().swap(patterns[p].start);
+    noOfActive--;
+    return true;
+  }
+
+  size_t size() const { return noOfActive; }
+  uint64_t eventsSeen() const { return position; }
+
+  void feed(EventId e) {
+    if (e < waiting.size()) {
+
+      // greedy patterns waiting for e
+      if (!waiting[e].empty()) {
+        current.swap(waiting[e]);
+        for (PatternId p : current) {
+          Pattern &pat = patterns[p];
+          if (!pat.active) {
+            continue;
+          }
+          if (++pat.cursor == pat.events.size()) {
+            pat.cursor = 0;
+            fired.push_back(p);
+          }
+          waiting[pat.events[pat.cursor]].push_back(p);
+        }
+        current.clear();
+      }
+
+      // windowed patterns containing e, compacting out removed ones
+      std::vector<Step> &bucket = steps[e];
+      size_t kept = 0;
+      PatternId justCompleted = UINT32_MAX;
+      for (size_t k = 0; k < bucket.size(); ++k) {
+        Step s = bucket[k];
+        Pattern &pat = patterns[s.p];
+        if (!pat.active) {
+          continue;
+        }
+        bucket[kept++] = s;
+
+        // the event that completed a match does not start the next one
+        if (s.p == justCompleted) {
+          continue;
+        }
+
+        uint64_t from = s.j == 0 ? position : pat.start[s.j];
+        if (from == NONE) {
+          continue;
+        }
+        pat.start[s.j + 1] = from;
+        if (s.j + 1 == pat.events.size() &&
+            position - from + 1 <= pat.window) {
+          pat.start.assign(pat.start.size(), NONE);
+          justCompleted = s.p;
+          fired.push_back(s.p);
+        }
+      }
+      bucket.resize(kept);
+    }
+
+    position++;
+
+    // callbacks run last, so they may add or remove patterns
+    for (PatternId p : fired) {
+      onMatch(p, position);
+    }
+    fired.clear();
+  }
+
+  void feed(const EventId *begin, const EventId *end) {
+    for (const EventId *e = begin; e < end; ++e) {
+      feed(*e);
+    }
+  }
+
+  void feed(const std::vector<EventId> &batch) {
+    feed(batch.data(), batch.data() + batch.size());
+  }
+};
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Check many patterns against one event log in a single pass
+ * Major Inputs  : A set of patterns and the event log A (as event ids)
+ * Major Outputs : For every pattern, whether it matched and where
+ *
+ * Every pattern keeps a cursor : the length of its prefix matched so far.
+ * The greedy check of one pattern only ever waits for one event, its next
+ * one. So the patterns are kept in buckets by the event they wait for, and
+ * an event of A only touches the bucket of patterns waiting for it.
+ *
+ * Each step moves a pattern from one bucket to another, so a pass costs
+ * O(n + total length of all patterns) instead of O(n * no of patterns).
+ *
+ */
+
+#ifndef MULTI_PATTERN_H
+#define MULTI_PATTERN_H
+
+#include <cstdint>
+#include <vector>
+
+#include "event-log.h"
+
+struct PatternMatch {
+  bool matched;
+  // number of events of A consumed when the pattern completed,
+  // i.e. index of its last matched event + 1. 0 for an empty pattern.
+  uint64_t end;
+};
+
+class MultiPatternMatcher {
+
+private:
+  std::vector<std::vector<EventId>> patterns;
+
+public:
+  // returns the index of the pattern, used to look up its result
+  size_t addPattern(const std::vector<EventId> &pattern) {
+    patterns.push_back(pattern);
+    return patterns.size() - 1;
+  }
+
+  size_t size() const { return patterns.size(); }
+  const std::vector<EventId> &pattern(size_t p) const { return patterns[p]; }
+
+  // Scans A once and reports the result of every pattern
+  std::vector<PatternMatch> match(const std::vector<EventId> &A) const {
+
+    size_t noOfPatterns = patterns.size();
+    std::vector<PatternMatch> result(noOfPatterns, PatternMatch{false, 0});
+    std::vector<uint32_t> cursor(noOfPatterns, 0);
+
+    // waiting[e] : patterns whose next needed event is e
+    EventId maxEvent = 0;
+    for (auto &p : patterns) {
+      for (EventId e : p) {
+        maxEvent = e > maxEvent ? e : maxEvent;
+      }
+    }
+    std::vector<std::vector<uint32_t>> waiting(maxEvent + 1);
+
+    size_t pending = 0;
+    for (size_t p = 0; p < noOfPatterns; ++p) {
+      if (patterns[p].empty()) {
+        result[p].matched = true;
+      } else {
+        waiting[patterns[p][0]].push_back(p);
+        pending++;
+      }
+    }
+
+    std::vector<uint32_t> current;
+    for (size_t i = 0; i < A.size() && pending; ++i) {
+      EventId e = A[i];
+      if (e > maxEvent || waiting[e].empty()) {
+        continue;
+      }
+
+      // take the bucket out first, so patterns needing `e` twice in a row
+      // wait for the next occurrence instead of matching this one again
+      current.swap(waiting[e]);
+      for (uint32_t p : current) {
+        uint32_t next = ++cursor[p];
+        if (next == patterns[p].size()) {
+          result[p].matched = true;
+          result[p].end = i + 1;
+          pending--;
+        } else {
+          waiting[patterns[p][next]].push_back(p);
+        }
+      }
+      current.clear();
+    }
+
+    return result;
+  }
+};
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -pthread
+ *
+ * Objective     : Subsequence check of one pattern using all cores
+ * Major Inputs  : Pattern B of length n, event log A, no of threads
+ * Major Outputs : Same answer as the serial greedy scan
+ *
+ * The greedy scan is a small state machine : the state is j, the length of
+ * the prefix of B matched so far. So A is split into chunks, and for every
+ * chunk (in parallel) we find out where it takes every possible state,
+ *
+ *     f_chunk(j) = prefix matched after the chunk, if j was matched before it
+ *
+ * The chunks are then combined in order starting from state 0. Because the
+ * state is a single integer, combining is one lookup per chunk.
+ *
+ * Computing f_chunk runs all n+1 states through the chunk together, kept
+ * in buckets by the event each of them waits for (as in multi-pattern.h).
+ * That costs O(chunk length + n * min(n, chunk length)), so it is cheap for
+ * short patterns. For long patterns the serial scan is used instead.
+ *
+ */
+
+#ifndef PARALLEL_SUBSEQUENCE_H
+#define PARALLEL_SUBSEQUENCE_H
+
+#include <cstdint>
+#include <thread>           // thread, hardware_concurrency
+#include <vector>
+
+#include "event-log.h"
+#include "multi-pattern.h"  // PatternMatch
+
+// Where the chunk A[from, to) takes every state 0..n of the greedy scan
+inline std::vector<uint32_t> chunkTransition(const std::vector<EventId> &B,
+                                             const EventId *from,
+                                             const EventId *to) {
+  uint32_t n = B.size();
+  std::vector<uint32_t> state(n + 1);
+  for (uint32_t j = 0; j <= n; ++j) {
+    state[j] = j;
+  }
+
+  // waiting[e] : starting states whose current state needs event e next
+  EventId maxEvent = 0;
+  for (EventId e : B) {
+    maxEvent = e > maxEvent ? e : maxEvent;
+  }
+  std::vector<std::vector<uint32_t>> waiting(maxEvent + 1);
+  for (uint32_t j = 0; j < n; ++j) {
+    waiting[B[j]].push_back(j);
+  }
+
+  size_t pending = n;
+  std::vector<uint32_t> current;
+  for (const EventId *p = from; p < to && pending; ++p) {
+    EventId e = *p;
+    if (e > maxEvent || waiting[e].empty()) {
+      continue;
+    }
+    current.swap(waiting[e]);
+    for (uint32_t j : current) {
+      uint32_t next = ++state[j];
+      if (next == n) {
+        pending--;
+      } else {
+        waiting[B[next]].push_back(j);
+      }
+    }
+    current.clear();
+  }
+
+  return state;
+}
+
+// Same as the greedy scan of isSubsequence, split over `noOfThreads` threads.
+// 0 threads means one per core.
+inline PatternMatch isSubsequenceParallel(const std::vector<EventId> &B,
+                                          const std::vector<EventId> &A,
+                                          unsigned noOfThreads = 0) {
+
+  size_t n = B.size();
+  size_t m = A.size();
+
+  if (noOfThreads == 0) {
+    noOfThreads = std::thread::hardware_concurrency();
+    noOfThreads = noOfThreads ? noOfThreads : 1;
+  }
+
+  // a few chunks per thread so an uneven chunk does not hold up the rest
+  size_t noOfChunks = noOfThreads == 1 ? 1 : 4 * noOfThreads;
+  size_t chunkSize = (m + noOfChunks - 1) / (noOfChunks ? noOfChunks : 1);
+
+  // serial scan from state j over A[from, to), returns the new state
+  // and sets `end` if the pattern completes inside it
+  auto scan = [&](size_t j, size_t from, size_t to, PatternMatch &res) {
+    for (size_t i = from; i < to && j < n; ++i) {
+      if (A[i] == B[j] && ++j == n) {
+        res.matched = true;
+        res.end = i + 1;
+      }
+    }
+    return j;
+  };
+
+  PatternMatch result{n == 0, 0};
+  if (n == 0) {
+    return result;
+  }
+
+  // not worth it : too short a log, or a pattern too long for f_chunk
+  if (noOfChunks == 1 || m < 2 * noOfChunks || n * n > chunkSize) {
+    scan(0, 0, m, result);
+    return result;
+  }
+
+  std::vector<std::vector<uint32_t>> transition(noOfChunks);
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < noOfThreads; ++t) {
+    workers.emplace_back([&, t]() {
+      for (size_t c = t; c < noOfChunks; c += noOfThreads) {
+        size_t from = c * chunkSize < m ? c * chunkSize : m;
+        size_t to = from + chunkSize < m ? from + chunkSize : m;
+        transition[c] = chunkTransition(B, A.data() + from, A.data() + to);
+      }
+    });
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  // combine in order : the first chunk that takes the state to n is where
+  // the pattern completes, rescan only that chunk to find the exact place
+  size_t j = 0;
+  for (size_t c = 0; c < noOfChunks; ++c) {
+    if (transition[c][j] == n) {
+      size_t from = c * chunkSize < m ? c * chunkSize : m;
+      size_t to = from + chunkSize < m ? from + chunkSize : m;
+      scan(j, from, to, result);
+      return result;
+    }
+    j = transition[c][j];
+  }
+
+  return result;
+}
+
+#endif
@@ -0,0 +1,537 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -O2 -pthread
+ *
+ * Objective : Benchmarks for the event log reader and subsequence matchers
+ *
+ * Usage :
+ *   subsequence-benchmark generate <file> <size in MB> [seed]
+ *   subsequence-benchmark parse    <file> [--getline]
+ *   subsequence-benchmark multi    <file> <max patterns> [seed]
+ *   subsequence-benchmark parallel <file> [max threads] [pattern length]
+ *   subsequence-benchmark live     <file> <patterns> [window] [seed]
+ *   subsequence-benchmark windows  <file> [pattern length] [seed]
+ *
+ * `generate` writes a random event log of the requested size.
+ * `parse` reads it with the mmap reader and reports parse time and peak
+ * resident memory. With --getline it instead reads it the old way into a
+ * vector<string> for comparison.
+ * `multi` matches 1, 10, 100 ... <max patterns> random patterns against the
+ * log in one pass, and against one isSubsequence scan per pattern. Its
+ * events / s counts the events read until the last pattern completed.
+ * `parallel` times the chunked parallel check with 1, 2, 4 ... threads
+ * against the serial scan, for a pattern that completes on the last event
+ * and for one that never matches. Use a multi-GB log to see the speedup.
+ * `live` feeds the log to a LiveMatcher holding random patterns, one event
+ * at a time to measure the latency of feed(), then in batches for the
+ * throughput.
+ * `windows` streams every minimal window of a random pattern through
+ * WindowSearch and counts its embeddings, and checks the windows against
+ * a forward / backward scan.
+ *
+ */
+
+#include <algorithm>        // sort
+#include <chrono>           // duration
+#include <cstdlib>          // atoll, strtoull
+#include <cstring>          // strcmp
+#include <fstream>          // ifstream, ofstream
+#include <iomanip>          // setprecision
+#include <iostream>         // cout, cerr
+#include <random>           // mt19937_64
+#include <string>           // string
+#include <thread>           // hardware_concurrency
+#include <utility>          // pair
+#include <vector>           // vector
+
+#include "../benchmark/bench.h"
+#include "event-log.h"
+#include "live-matcher.h"
+#include "multi-pattern.h"
+#include "parallel-subsequence.h"
+#include "subsequence-windows.h"
+#include "subsequence.h"
+
+using namespace std;
+
+// Random log in the style of eventsA.txt : "<action> <company>" per line
+static int generate(const char *path, unsigned long long sizeMB,
+                    unsigned long long seed) {
+
+  const char *actions[] = {"buy", "sell", "hold", "short", "cover"};
+  const char *companies[] = {"Amazon", "Yahoo",  "eBay",   "Oracle",
+                             "Google", "Apple",  "IBM",    "Intel",
+                             "Adobe",  "Cisco",  "Nvidia", "Netflix"};
+  const int noOfActions = sizeof(actions) / sizeof(actions[0]);
+  const int noOfCompanies = sizeof(companies) / sizeof(companies[0]);
+
+  ofstream out(path, ios::binary);
+  if (!out) {
+    cerr << "Error : could not create " << path << "\n";
+    return 1;
+  }
+
+  mt19937_64 rng(seed);
+  unsigned long long target = sizeMB * 1024 * 1024;
+  unsigned long long written = 0;
+
+  string chunk;
+  chunk.reserve(1 << 20);
+  while (written < target) {
+    chunk.clear();
+    while (chunk.size() < (1u << 20) - 64 && written + chunk.size() < target) {
+      uint64_t r = rng();
+      chunk += actions[r % noOfActions];
+      chunk += ' ';
+      chunk += companies[(r >> 8) % noOfCompanies];
+      chunk += '\n';
+    }
+    out.write(chunk.data(), chunk.size());
+    written += chunk.size();
+  }
+
+  cout << "Wrote " << written << " bytes to " << path << "\n";
+  return 0;
+}
+
+static int parse(const char *path, bool useGetline) {
+
+  Clock::time_point start = Clock::now();
+  size_t noOfEvents = 0;
+  size_t distinct = 0;
+  double dataMB = 0;
+
+  if (useGetline) {
+    ifstream iob(path);
+    if (!iob) {
+      cerr << "Error : could not open " << path << "\n";
+      return 1;
+    }
+    vector<string> A;
+    string temp;
+    while (getline(iob, temp)) {
+      A.push_back(temp);
+    }
+    noOfEvents = A.size();
+    for (auto &s : A) {
+      dataMB += sizeof(string) + (s.capacity() > 15 ? s.capacity() : 0);
+    }
+  } else {
+    EventDictionary dict;
+    vector<EventId> A;
+    if (!readEventLog(path, dict, A)) {
+      cerr << "Error : could not open " << path << "\n";
+      return 1;
+    }
+    noOfEvents = A.size();
+    distinct = dict.size();
+    dataMB = A.capacity() * sizeof(EventId) + dict.memoryUsage();
+  }
+
+  double elapsed = secondsSince(start);
+  dataMB /= 1024.0 * 1024.0;
+
+  cout << fixed << setprecision(3);
+  cout << "reader          : " << (useGetline ? "getline" : "mmap") << "\n";
+  cout << "events          : " << noOfEvents << "\n";
+  if (!useGetline) {
+    cout << "distinct events : " << distinct << "\n";
+  }
+  cout << "parse time (s)  : " << elapsed << "\n";
+  cout << "events / s      : " << noOfEvents / elapsed << "\n";
+  cout << "log memory (MB) : " << dataMB << "\n";
+  cout << "peak RSS (MB)   : " << peakRssKB() / 1024.0 << "\n";
+  return 0;
+}
+
+// Random patterns of 4 to 16 events. One in four ends in an event that is
+// not in the log, so it never matches and forces a scan of the whole log.
+static vector<vector<EventId>> randomPatterns(size_t count, size_t noOfEvents,
+                                              mt19937_64 &rng) {
+  vector<vector<EventId>> patterns(count);
+  for (size_t p = 0; p < count; ++p) {
+    size_t len = 4 + rng() % 13;
+    for (size_t k = 0; k < len; ++k) {
+      patterns[p].push_back(rng() % noOfEvents);
+    }
+    if (p % 4 == 3) {
+      patterns[p].back() = noOfEvents;
+    }
+  }
+  return patterns;
+}
+
+// the greedy scan of isSubsequence(), also telling where B completes
+static PatternMatch greedyMatch(const vector<EventId> &B,
+                                const vector<EventId> &A) {
+  size_t j = 0, i = 0;
+  for (; i < A.size() && j < B.size(); ++i) {
+    if (A[i] == B[j]) {
+      j++;
+    }
+  }
+  return PatternMatch{j == B.size(), j == B.size() ? i : 0};
+}
+
+static int multi(const char *path, size_t maxPatterns,
+                 unsigned long long seed) {
+
+  EventDictionary dict;
+  vector<EventId> A;
+  if (!readEventLog(path, dict, A)) {
+    cerr << "Error : could not open " << path << "\n";
+    return 1;
+  }
+  if (A.empty()) {
+    cerr << "Error : empty log\n";
+    return 1;
+  }
+
+  mt19937_64 rng(seed);
+
+  // the naive way is one scan per pattern, only time it while it is sane
+  const size_t maxNaive = 1000;
+
+  cout << fixed << setprecision(3);
+  cout << setw(10) << "patterns" << setw(10) << "matched" << setw(14)
+       << "one pass (s)" << setw(14) << "naive (s)" << setw(18)
+       << "events / s" << "\n";
+
+  for (size_t count = 1; count <= maxPatterns; count *= 10) {
+    vector<vector<EventId>> patterns = randomPatterns(count, dict.size(), rng);
+
+    MultiPatternMatcher matcher;
+    for (auto &p : patterns) {
+      matcher.addPattern(p);
+    }
+
+    Clock::time_point start = Clock::now();
+    vector<PatternMatch> result = matcher.match(A);
+    double onePass = secondsSince(start);
+
+    // match() stops once every pattern has completed, so only count the
+    // events it actually read
+    size_t matched = 0;
+    uint64_t consumed = 0;
+    for (auto &r : result) {
+      matched += r.matched;
+      consumed = r.end > consumed ? r.end : consumed;
+    }
+    if (matched < result.size()) {
+      consumed = A.size();
+    }
+
+    cout << setw(10) << count << setw(10) << matched << setw(14) << onePass;
+
+    if (count <= maxNaive) {
+      start = Clock::now();
+      vector<bool> naiveMatched(count);
+      for (size_t p = 0; p < count; ++p) {
+        naiveMatched[p] = isSubsequence(patterns[p], A);
+      }
+      double naive = secondsSince(start);
+      cout << setw(14) << naive;
+
+      // every pattern on its own, where it ends as well (not timed)
+      for (size_t p = 0; p < count; ++p) {
+        PatternMatch expected = greedyMatch(patterns[p], A);
+        if (naiveMatched[p] != expected.matched ||
+            result[p].matched != expected.matched ||
+            (expected.matched && result[p].end != expected.end)) {
+          cerr << "\nError : one pass and naive results differ for pattern "
+               << p << "\n";
+          return 1;
+        }
+      }
+    } else {
+      cout << setw(14) << "-";
+    }
+    cout << setw(18) << consumed / onePass << "\n";
+  }
+  return 0;
+}
+
+static int parallel(const char *path, unsigned maxThreads, size_t n) {
+
+  EventDictionary dict;
+  vector<EventId> A;
+  if (!readEventLog(path, dict, A)) {
+    cerr << "Error : could not open " << path << "\n";
+    return 1;
+  }
+  if (A.empty() || n == 0) {
+    cerr << "Error : empty log or pattern\n";
+    return 1;
+  }
+
+  // evenly spaced events of A, ending with a marker event appended to the
+  // log : the greedy scan has to read the whole log before it completes
+  EventId marker = dict.intern("end of log");
+  A.push_back(marker);
+  vector<EventId> hit;
+  for (size_t k = 1; k < n; ++k) {
+    hit.push_back(A[k * (A.size() - 1) / n]);
+  }
+  hit.push_back(marker);
+  // same, with an event that is not in the log at the end
+  vector<EventId> miss = hit;
+  miss.back() = dict.size();
+
+  cout << fixed << setprecision(3);
+  cout << "events : " << A.size() << ", pattern length : " << n << "\n\n";
+  cout << setw(10) << "pattern" << setw(10) << "threads" << setw(12)
+       << "time (s)" << setw(10) << "speedup" << "\n";
+
+  const vector<EventId> *patterns[] = {&hit, &miss};
+  const char *names[] = {"hit", "miss"};
+  for (int k = 0; k < 2; ++k) {
+    const vector<EventId> &B = *patterns[k];
+
+    Clock::time_point start = Clock::now();
+    bool expected = isSubsequence(B, A);
+    double serial = secondsSince(start);
+    cout << setw(10) << names[k] << setw(10) << "serial" << setw(12) << serial
+         << setw(10) << 1.0 << "\n";
+
+    for (unsigned t = 1; t <= maxThreads; t *= 2) {
+      start = Clock::now();
+      PatternMatch res = isSubsequenceParallel(B, A, t);
+      double elapsed = secondsSince(start);
+      cout << setw(10) << names[k] << setw(10) << t << setw(12) << elapsed
+           << setw(10) << serial / elapsed << "\n";
+      if (res.matched != expected || (expected && res.end != A.size())) {
+        cerr << "\nError : parallel and serial results differ\n";
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+static int live(const char *path, size_t noOfPatterns, uint64_t window,
+                unsigned long long seed) {
+
+  EventDictionary dict;
+  vector<EventId> A;
+  if (!readEventLog(path, dict, A)) {
+    cerr << "Error : could not open " << path << "\n";
+    return 1;
+  }
+  if (A.empty()) {
+    cerr << "Error : empty log\n";
+    return 1;
+  }
+
+  mt19937_64 rng(seed);
+  vector<vector<EventId>> patterns =
+      randomPatterns(noOfPatterns, dict.size(), rng);
+
+  uint64_t noOfMatches = 0;
+  auto makeMatcher = [&](LiveMatcher &matcher) {
+    for (auto &p : patterns) {
+      matcher.addPattern(p, window);
+    }
+  };
+
+  // latency : time single feed() calls over the first million events
+  size_t sampled = A.size() < 1000000 ? A.size() : 1000000;
+  vector<double> latency(sampled);
+  {
+    LiveMatcher matcher([&](PatternId, uint64_t) { noOfMatches++; });
+    makeMatcher(matcher);
+    for (size_t i = 0; i < sampled; ++i) {
+      Clock::time_point start = Clock::now();
+      matcher.feed(A[i]);
+      latency[i] = chrono::duration<double, nano>(Clock::now() - start).count();
+    }
+  }
+  sort(latency.begin(), latency.end());
+  double mean = 0;
+  for (double l : latency) {
+    mean += l / sampled;
+  }
+
+  // throughput : the whole log in batches of 64K events
+  noOfMatches = 0;
+  LiveMatcher matcher([&](PatternId, uint64_t) { noOfMatches++; });
+  makeMatcher(matcher);
+  const size_t batchSize = 1 << 16;
+  Clock::time_point start = Clock::now();
+  for (size_t i = 0; i < A.size(); i += batchSize) {
+    size_t to = i + batchSize < A.size() ? i + batchSize : A.size();
+    matcher.feed(A.data() + i, A.data() + to);
+  }
+  double elapsed = secondsSince(start);
+
+  cout << fixed << setprecision(3);
+  cout << "patterns              : " << noOfPatterns << "\n";
+  cout << "window                : " << window << "\n";
+  cout << "events                : " << A.size() << "\n";
+  cout << "matches               : " << noOfMatches << "\n";
+  if (sampled) {
+    cout << "feed latency mean (ns): " << mean << "\n";
+    cout << "feed latency p50 (ns) : " << latency[sampled / 2] << "\n";
+    cout << "feed latency p99 (ns) : " << latency[sampled * 99 / 100] << "\n";
+    cout << "feed latency max (ns) : " << latency.back() << "\n";
+  }
+  cout << "batch time (s)        : " << elapsed << "\n";
+  cout << "events / s            : " << A.size() / elapsed << "\n";
+  return 0;
+}
+
+// Minimal windows the other way : from p, a forward greedy scan finds the
+// first end of B, a backward greedy scan from there the latest start s,
+// and the next window starts after s. Costs the total length of the
+// windows scanned.
+static void forwardBackward(const vector<EventId> &B, const vector<EventId> &A,
+                            vector<pair<uint64_t, uint64_t>> &windows) {
+  size_t m = B.size();
+  size_t p = 0;
+  while (m && p < A.size()) {
+    size_t j = 0, i = p;
+    for (; i < A.size() && j < m; ++i) {
+      j += A[i] == B[j];
+    }
+    if (j < m) {
+      return;
+    }
+    size_t last = i - 1, s = i;
+    for (j = m; j > 0;) {
+      --s;
+      j -= A[s] == B[j - 1];
+    }
+    windows.push_back({s, last});
+    p = s + 1;
+  }
+}
+
+static int windows(const char *path, size_t n, unsigned long long seed) {
+
+  EventDictionary dict;
+  vector<EventId> A;
+  if (!readEventLog(path, dict, A)) {
+    cerr << "Error : could not open " << path << "\n";
+    return 1;
+  }
+  if (A.empty() || n == 0) {
+    cerr << "Error : empty log or pattern\n";
+    return 1;
+  }
+
+  // events picked from the log, so the pattern occurs many times
+  mt19937_64 rng(seed);
+  vector<EventId> B(n);
+  for (auto &e : B) {
+    e = A[rng() % A.size()];
+  }
+
+  const uint64_t prime = 1000000007;
+  uint64_t shortest = UINT64_MAX, checksum = 0;
+  WindowSearch search(B, [&](uint64_t first, uint64_t last) {
+    shortest = last - first + 1 < shortest ? last - first + 1 : shortest;
+    checksum = checksum * 31 + first * 7 + last;
+  });
+  WindowSearch modular(B, nullptr, prime);
+
+  Clock::time_point start = Clock::now();
+  search.feed(A);
+  double streamed = secondsSince(start);
+  modular.feed(A);
+
+  vector<pair<uint64_t, uint64_t>> expected;
+  start = Clock::now();
+  forwardBackward(B, A, expected);
+  double scanned = secondsSince(start);
+
+  uint64_t expectedSum = 0;
+  for (auto &w : expected) {
+    expectedSum = expectedSum * 31 + w.first * 7 + w.second;
+  }
+  if (expected.size() != search.windows() || expectedSum != checksum) {
+    cerr << "Error : streamed and forward / backward windows differ\n";
+    return 1;
+  }
+
+  cout << fixed << setprecision(3);
+  cout << "events                  : " << A.size() << "\n";
+  cout << "pattern length          : " << n << "\n";
+  cout << "minimal windows         : " << search.windows() << "\n";
+  if (search.windows()) {
+    cout << "shortest window         : " << shortest << "\n";
+  }
+  cout << "embeddings              : ";
+  if (search.overflowed()) {
+    cout << "more than 2^64\n";
+  } else {
+    cout << search.embeddings() << "\n";
+  }
+  cout << "embeddings mod 1e9+7    : " << modular.embeddings() << "\n";
+  cout << "streamed (s)            : " << streamed << "\n";
+  cout << "forward / backward (s)  : " << scanned << "\n";
+  cout << "events / s              : " << A.size() / streamed << "\n";
+  cout << "peak RSS (MB)           : " << peakRssKB() / 1024.0 << "\n";
+  return 0;
+}
+
+static void usage() {
+  cerr << "Usage :\n"
+       << "  subsequence-benchmark generate <file> <size in MB> [seed]\n"
+       << "  subsequence-benchmark parse    <file> [--getline]\n"
+       << "  subsequence-benchmark multi    <file> <max patterns> [seed]\n"
+       << "  subsequence-benchmark parallel <file> [max threads] "
+          "[pattern length]\n"
+       << "  subsequence-benchmark live     <file> <patterns> [window] "
+          "[seed]\n"
+       << "  subsequence-benchmark windows  <file> [pattern length] [seed]\n";
+}
+
+int main(int argc, char *argv[]) {
+
+  if (argc < 3) {
+    usage();
+    return 1;
+  }
+
+  if (strcmp(argv[1], "generate") == 0 && argc >= 4) {
+    unsigned long long seed = argc >= 5 ? strtoull(argv[4], nullptr, 10) : 1;
+    return generate(argv[2], strtoull(argv[3], nullptr, 10), seed);
+  }
+
+  if (strcmp(argv[1], "parse") == 0) {
+    bool useGetline = argc >= 4 && strcmp(argv[3], "--getline") == 0;
+    return parse(argv[2], useGetline);
+  }
+
+  if (strcmp(argv[1], "multi") == 0 && argc >= 4) {
+    unsigned long long seed = argc >= 5 ? strtoull(argv[4], nullptr, 10) : 1;
+    return multi(argv[2], strtoull(argv[3], nullptr, 10), seed);
+  }
+
+  if (strcmp(argv[1], "parallel") == 0) {
+    unsigned maxThreads = thread::hardware_concurrency();
+    if (argc >= 4) {
+      maxThreads = strtoul(argv[3], nullptr, 10);
+    }
+    size_t n = argc >= 5 ? strtoull(argv[4], nullptr, 10) : 8;
+    return parallel(argv[2], maxThreads ? maxThreads : 1, n);
+  }
+
+  if (strcmp(argv[1], "live") == 0 && argc >= 4) {
+    uint64_t window = argc >= 5 ? strtoull(argv[4], nullptr, 10) : 0;
+    unsigned long long seed = argc >= 6 ? strtoull(argv[5], nullptr, 10) : 1;
+    return live(argv[2], strtoull(argv[3], nullptr, 10), window, seed);
+  }
+
+  if (strcmp(argv[1], "windows") == 0) {
+    size_t n = argc >= 4 ? strtoull(argv[3], nullptr, 10) : 8;
+    unsigned long long seed = argc >= 5 ? strtoull(argv[4], nullptr, 10) : 1;
+    return windows(argv[2], n, seed);
+  }
+
+  usage();
+  return 1;
+}
@@ -0,0 +1,200 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Every minimal window of an event log containing pattern B
+ *                 as a subsequence, and the no of ways B occurs in the log
+ * Major Inputs  : Pattern B, then the events of A one at a time or in batches
+ * Major Outputs : A callback per minimal window, the count of embeddings
+ *
+ * A window A[first..last] is minimal if B is a subsequence of it but of no
+ * shorter window inside it.
+ *
+ * As in the windowed patterns of live-matcher.h, start[j] is the latest
+ * position at which a match of B[0..j) ending at or before the current
+ * event can begin. An event e extends every prefix that ends just before
+ * an e in B. When it completes B, [start[m], current] is the shortest
+ * window ending here, and it is minimal exactly when its start is past the
+ * start of the previous window. So the windows come out in order, as the
+ * events arrive, and nothing but the pattern is kept.
+ *
+ * The same steps count embeddings (index sequences i1 < i2 < ... < im with
+ * A[ik] = B[k]) : ways[j] is the no of embeddings of B[0..j) seen so far,
+ * and an e adds ways[j] to ways[j+1] for every B[j] == e.
+ *
+ * Both cost one step per occurrence of the event in B, and O(m) memory.
+ * The occurrences are kept by event in one flat array, last one first, so
+ * that one event never extends two prefixes in a row. The range of each
+ * event is found through a small open addressing table of the distinct
+ * events of B, so the memory does not depend on how large the ids are.
+ * A 4096 bit filter on the low bits of the id skips most events that are
+ * not in B before they are hashed.
+ *
+ * The count grows exponentially with m. With a modulus it is kept modulo
+ * it, without one it is exact until it passes 2^64, after which
+ * overflowed() is set and the count is only right modulo 2^64.
+ *
+ */
+
+#ifndef SUBSEQUENCE_WINDOWS_H
+#define SUBSEQUENCE_WINDOWS_H
+
+#include <algorithm>        // sort
+#include <cstdint>
+#include <functional>       // function
+#include <utility>          // pair
+#include <vector>
+
+#include "../benchmark/stats.h"
+#include "event-log.h"
+
+class WindowSearch {
+
+public:
+  // called with the first and last event (0 based, inclusive) of a window
+  typedef std::function<void(uint64_t, uint64_t)> WindowCallback;
+
+private:
+  enum : uint64_t { NONE = UINT64_MAX };
+
+  // the occurrences of one event of B : slots[first..last)
+  struct Range {
+    EventId event;
+    uint32_t first, last; // first == last : unused
+  };
+
+  size_t m;
+  std::vector<Range> table;     // by hash of the event, size a power of 2
+  size_t mask;
+  uint64_t filter[64];          // bit e % 4096 set if e may be in B
+  std::vector<uint32_t> slots;  // j for every B[j], grouped by event
+  std::vector<uint64_t> start;  // start[j] for j = 1..m
+  std::vector<uint64_t> ways;   // ways[j] for j = 0..m
+  uint64_t modulus;             // 0 : exact
+  bool overflow;
+  uint64_t lastStart;           // start of the last window reported
+  uint64_t position;            // no of events fed so far
+  uint64_t noOfWindows;
+  WindowCallback onWindow;
+
+  static size_t hashOf(EventId e) {
+    uint32_t h = e * 2654435761u;
+    return h ^ (h >> 16);
+  }
+
+  const Range *find(EventId e) const {
+    if (!(filter[(e >> 6) & 63] >> (e & 63) & 1)) {
+      return nullptr;
+    }
+    for (size_t i = hashOf(e) & mask; table[i].first != table[i].last;
+         i = (i + 1) & mask) {
+      if (table[i].event == e) {
+        return &table[i];
+      }
+    }
+    return nullptr;
+  }
+
+  void addWays(uint64_t &to, uint64_t add) {
+    if (modulus) {
+      to = to >= modulus - add ? to - (modulus - add) : to + add;
+    } else {
+      overflow = overflow || to > UINT64_MAX - add;
+      to += add;
+    }
+  }
+
+public:
+  WindowSearch(const std::vector<EventId> &B, WindowCallback callback,
+               uint64_t _modulus = 0)
+      : m(B.size()), start(B.size() + 1, NONE), ways(B.size() + 1, 0),
+        modulus(_modulus), overflow(false), lastStart(NONE), position(0),
+        noOfWindows(0), onWindow(callback) {
+
+    ways[0] = modulus == 1 ? 0 : 1;
+
+    // positions of B by event, the last one first
+    std::vector<std::pair<EventId, uint32_t>> byEvent(m);
+    for (size_t j = 0; j < m; ++j) {
+      byEvent[j] = {B[j], ~(uint32_t)j};
+    }
+    std::sort(byEvent.begin(), byEvent.end());
+
+    for (auto &f : filter) {
+      f = 0;
+    }
+    for (EventId e : B) {
+      filter[(e >> 6) & 63] |= uint64_t(1) << (e & 63);
+    }
+
+    size_t size = 2;
+    while (size < 2 * m) {
+      size *= 2;
+    }
+    table.assign(size, Range{0, 0, 0});
+    mask = size - 1;
+
+    slots.resize(m);
+    uint32_t first = 0;
+    for (size_t k = 0; k < m; ++k) {
+      slots[k] = ~byEvent[k].second;
+      if (k + 1 == m || byEvent[k + 1].first != byEvent[k].first) {
+        EventId e = byEvent[k].first;
+        size_t i = hashOf(e) & mask;
+        while (table[i].first != table[i].last) {
+          i = (i + 1) & mask;
+        }
+        table[i] = Range{e, first, (uint32_t)k + 1};
+        first = k + 1;
+      }
+    }
+  }
+
+  uint64_t eventsSeen() const { return position; }
+  uint64_t windows() const { return noOfWindows; }
+
+  // no of embeddings of B in the events so far (modulo the modulus)
+  uint64_t embeddings() const { return ways[m]; }
+  bool overflowed() const { return overflow; }
+
+  void feed(EventId e) {
+    const Range *r = find(e);
+    if (r) {
+      for (uint32_t k = r->first; k < r->last; ++k) {
+        STAT_COUNT("subsequence-windows.steps");
+        uint32_t j = slots[k];
+        addWays(ways[j + 1], ways[j]);
+
+        uint64_t from = j == 0 ? position : start[j];
+        if (from == NONE) {
+          continue;
+        }
+        start[j + 1] = from;
+        if (j + 1 == m && (lastStart == NONE || from > lastStart)) {
+          lastStart = from;
+          noOfWindows++;
+          if (onWindow) {
+            onWindow(from, position);
+          }
+        }
+      }
+    }
+    position++;
+  }
+
+  void feed(const EventId *begin, const EventId *end) {
+    for (const EventId *e = begin; e < end; ++e) {
+      feed(*e);
+    }
+  }
+
+  void feed(const std::vector<EventId> &batch) {
+    feed(batch.data(), batch.data() + batch.size());
+  }
+};
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Author : Jatin Rohilla, moved into this header by agent (Oct-2026)
+ * Date   : Nov-2018
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective     : Greedy O(m + n) subsequence check
+ * Major Inputs  : Pattern B and event log A
+ * Major Outputs : true if B is a subsequence of A
+ *
+ */
+
+#ifndef SUBSEQUENCE_H
+#define SUBSEQUENCE_H
+
+#include <string>
+#include <vector>
+
+// benchmark/stats-overhead.cpp keeps a copy of this solver without the
+// STAT_ lines (plainIsSubsequence), a change here has to be made there too.
+#include "../benchmark/stats.h"
+#include "event-log.h"
+
+// checks if B is a subSequence of A
+template <typename T>
+bool isSubsequence(const std::vector<T> &B, const std::vector<T> &A) {
+
+  size_t m = A.size();
+  size_t n = B.size();
+
+  if (m < n) {
+    return false;
+  }
+
+  size_t j = 0;
+  size_t i = 0;
+  for (; i < m && j < n; ++i) {
+    if (A[i] == B[j]) {
+      j++;
+    }
+  }
+  STAT_ADD("subsequence.events_scanned", i);
+
+  return (j == n);
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective : Follow a growing event log and report every pattern the
+ *             moment it completes
+ *
+ * Usage :
+ *   tail-events <event log> <patterns file> [window]
+ *
+ * The patterns file has one event per line like eventsB.txt, with a blank
+ * line between patterns. With a window of T, a pattern only counts if it
+ * completes within T events.
+ *
+ * The log is read in large blocks, the events of each block are fed to
+ * the matcher as one batch. At the end of the file it waits for more
+ * lines to be appended, like `tail -f`. Stop it with Ctrl+C.
+ *
+ */
+
+#include <chrono>           // milliseconds
+#include <cstdlib>          // strtoull
+#include <fstream>          // ifstream
+#include <iostream>         // cout, cerr
+#include <string>           // string
+#include <thread>           // sleep_for
+#include <vector>           // vector
+
+#include "event-log.h"
+#include "live-matcher.h"
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+
+  if (argc < 3) {
+    cerr << "Usage : tail-events <event log> <patterns file> [window]\n";
+    return 1;
+  }
+  uint64_t window = argc >= 4 ? strtoull(argv[3], nullptr, 10) : 0;
+
+  // read the patterns, blank lines separate them
+  EventDictionary dict;
+  vector<vector<EventId>> patterns(1);
+  {
+    MappedFile file;
+    if (!file.open(argv[2])) {
+      cerr << "Error : could not open " << argv[2] << "\n";
+      return 1;
+    }
+    forEachLine(file.data(), file.data() + file.size(),
+                [&](const char *s, size_t len) {
+                  if (len == 0) {
+                    if (!patterns.back().empty()) {
+                      patterns.emplace_back();
+                    }
+                  } else {
+                    patterns.back().push_back(dict.intern(s, len));
+                  }
+                });
+    if (patterns.back().empty()) {
+      patterns.pop_back();
+    }
+  }
+
+  bool fired = false; // a match is waiting in cout
+  LiveMatcher matcher([&](PatternId p, uint64_t end) {
+    cout << "Pattern " << p + 1 << " completed at event " << end << "\n";
+    fired = true;
+  });
+  for (auto &p : patterns) {
+    matcher.addPattern(p, window);
+  }
+  cout << "Watching " << argv[1] << " for " << patterns.size()
+       << " patterns ...\n";
+
+  ifstream iob(argv[1], ios::binary);
+  if (!iob) {
+    cerr << "Error : could not open " << argv[1] << "\n";
+    return 1;
+  }
+
+  // events that are in no pattern can never match, they are fed as an id
+  // no pattern uses instead of being added to the dictionary
+  const EventId unknown = dict.size();
+
+  vector<char> buffer(1 << 20);
+  string partial; // an incomplete last line, waiting for the rest
+  vector<EventId> batch;
+
+  while (true) {
+    iob.read(buffer.data(), buffer.size());
+    size_t got = iob.gcount();
+
+    if (got == 0) {
+      // end of file for now, wait for the log to grow
+      iob.clear();
+      cout.flush();
+      this_thread::sleep_for(chrono::milliseconds(200));
+      continue;
+    }
+
+    const char *begin = buffer.data();
+    const char *end = begin + got;
+
+    // only complete lines are tokenized, the rest waits for the next read
+    const char *lastNewline = end;
+    while (lastNewline > begin && lastNewline[-1] != '\n') {
+      lastNewline--;
+    }
+    if (lastNewline == begin) {
+      partial.append(begin, end);
+      continue;
+    }
+
+    batch.clear();
+    auto addEvent = [&](const char *s, size_t len) {
+      EventId e = dict.find(s, len);
+      batch.push_back(e == EventDictionary::NOT_FOUND ? unknown : e);
+    };
+
+    const char *from = begin;
+    if (!partial.empty()) {
+      const char *nl = static_cast<const char *>(memchr(begin, '\n', got));
+      partial.append(begin, nl);
+      forEachLine(partial.data(), partial.data() + partial.size(), addEvent);
+      partial.clear();
+      from = nl + 1;
+    }
+    forEachLine(from, lastNewline, addEvent);
+    partial.assign(lastNewline, end);
+
+    matcher.feed(batch);
+
+    // report the matches of this block now, even if the log keeps growing
+    // or stdout is a pipe
+    if (fired) {
+      cout.flush();
+      fired = false;
+    }
+  }
+
+  return 0;
+}
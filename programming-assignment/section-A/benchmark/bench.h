@@ -0,0 +1,153 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective : Timing, memory and output helpers shared by the benchmarks
+ *
+ * One BenchRecord is written per run, either as a CSV row or as an
+ * element of a JSON array, so the results can be diffed between commits
+ * or plotted.
+ *
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>           // steady_clock
+#include <cstdint>          // uint64_t
+#include <fstream>          // ifstream, ofstream
+#include <iostream>         // ostream
+#include <sstream>          // ostringstream
+#include <string>           // string
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>   // getrusage
+#endif
+
+typedef std::chrono::steady_clock Clock;
+
+inline double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Reads a "<key>:   <value> kB" line of /proc/self/status, -1 if missing
+inline long procStatusKB(const char *key) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  std::string prefix = std::string(key) + ":";
+  while (getline(status, line)) {
+    if (line.compare(0, prefix.size(), prefix) == 0) {
+      return std::stol(line.substr(prefix.size()));
+    }
+  }
+  return -1;
+}
+
+// peak resident set size of the process in KB, 0 if unknown
+inline long peakRssKB() {
+  long hwm = procStatusKB("VmHWM");
+  if (hwm >= 0) {
+    return hwm;
+  }
+#if defined(__APPLE__)
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss / 1024; // bytes on macOS
+#elif defined(__unix__)
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss;        // KB on linux
+#else
+  return 0;
+#endif
+}
+
+struct BenchRecord {
+  std::string solver;    // e.g. dijkstra
+  std::string workload;  // input family, e.g. grid
+  long long size;        // main size parameter of the input
+  uint64_t seed;
+  double seconds;        // best wall time of the repetitions
+  double throughput;     // units per second
+  std::string unit;      // what throughput counts, e.g. edges
+  long peakRssKB;
+  std::string result;    // answer of the solver, to catch regressions
+};
+
+// Writes BenchRecords as CSV (with a header row) or as a JSON array
+class ResultWriter {
+
+private:
+  std::ostream &out;
+  bool json;
+  bool first;
+
+  static std::string jsonString(const std::string &s) {
+    std::string res = "\"";
+    for (char c : s) {
+      if (c == '"' || c == '\\') {
+        res += '\\';
+      }
+      res += c;
+    }
+    return res + "\"";
+  }
+
+  static std::string csvField(const std::string &s) {
+    if (s.find_first_of(",\"\n") == std::string::npos) {
+      return s;
+    }
+    std::string res = "\"";
+    for (char c : s) {
+      res += c;
+      if (c == '"') {
+        res += '"';
+      }
+    }
+    return res + "\"";
+  }
+
+public:
+  ResultWriter(std::ostream &_out, bool _json)
+      : out(_out), json(_json), first(true) {}
+
+  void write(const BenchRecord &r) {
+    std::ostringstream row;
+    row.precision(6);
+    if (json) {
+      row << (first ? "[\n" : ",\n") << "  {\"solver\": " << jsonString(r.solver)
+          << ", \"workload\": " << jsonString(r.workload)
+          << ", \"size\": " << r.size << ", \"seed\": " << r.seed
+          << ", \"seconds\": " << r.seconds
+          << ", \"throughput\": " << r.throughput
+          << ", \"unit\": " << jsonString(r.unit)
+          << ", \"peak_rss_kb\": " << r.peakRssKB
+          << ", \"result\": " << jsonString(r.result) << "}";
+    } else {
+      if (first) {
+        row << "solver,workload,size,seed,seconds,throughput,unit,"
+               "peak_rss_kb,result\n";
+      }
+      row << csvField(r.solver) << ',' << csvField(r.workload) << ','
+          << r.size << ',' << r.seed << ',' << r.seconds << ','
+          << r.throughput << ',' << csvField(r.unit) << ',' << r.peakRssKB
+          << ',' << csvField(r.result) << "\n";
+    }
+    out << row.str();
+    out.flush();
+    first = false;
+  }
+
+  void finish() {
+    if (json) {
+      out << (first ? "[]\n" : "\n]\n");
+    }
+    out.flush();
+  }
+};
+
+#endif
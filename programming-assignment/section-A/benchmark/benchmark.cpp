@@ -0,0 +1,385 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -O2
+ *
+ * Objective : Time every section-A solver on generated inputs of growing
+ *             size, without any interaction
+ *
+ * Usage :
+ *   benchmark [--only <solver>] [--format csv|json] [--output <file>]
+ *             [--seed <n>] [--repeat <n>] [--scale <x>] [--list]
+ *
+ *   --only    run only the solvers whose name starts with <solver>
+ *   --format  csv (default) or json
+ *   --output  write the results to a file instead of stdout
+ *   --seed    seed of the input generators (default 1)
+ *   --repeat  runs per input, the best time is kept (default 3)
+ *   --scale   multiplies the input sizes (default 1)
+ *   --list    print the solver names and exit
+ *
+ */
+
+#include <cstdlib>          // strtod, strtoull
+#include <cstring>          // strcmp
+#include <fstream>          // ofstream
+#include <functional>       // function
+#include <iostream>         // cout, cerr
+#include <memory>           // make_shared, shared_ptr
+#include <sstream>          // istringstream, ostringstream
+#include <string>           // string, to_string
+#include <vector>           // vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>       // waitpid
+#include <unistd.h>         // fork, pipe
+#define HAVE_FORK 1
+#endif
+
+#include "bench.h"
+#include "generators.h"
+
+#include "../Q1/matrix-chain-multiplication.h"
+#include "../Q2/bellman-ford-shortest-path.h"
+#include "../Q2/dijkstra-shortest-path.h"
+#include "../Q3/NQueens.h"
+#include "../Q4/highway-billboard-problem.h"
+#include "../Q5/subsequence.h"
+
+using namespace std;
+
+struct Options {
+  string only;
+  bool json = false;
+  uint64_t seed = 1;
+  int repeat = 3;
+  double scale = 1;
+};
+
+// A generated input, `run` solves it and returns the answer as a string
+struct Prepared {
+  double units;  // amount of work throughput is measured in
+  function<string()> run;
+};
+
+// One point of a size sweep. The input is only generated by `prepare`, just
+// before it is timed, so the inputs of other sizes are not in memory.
+struct Case {
+  string workload;
+  long long size;
+  function<Prepared()> prepare;
+};
+
+struct Solver {
+  string name;
+  string unit;
+  // builds the cases of one size sweep from the seed and the scale
+  function<vector<Case>(uint64_t, double)> cases;
+};
+
+static long long scaled(long long size, double scale) {
+  long long s = static_cast<long long>(size * scale);
+  return s > 1 ? s : 1;
+}
+
+template <typename G>
+static void addEdges(G &g, const vector<Edge> &edges) {
+  for (const Edge &e : edges) {
+    g.add_edge(e.u, e.v, e.w);
+  }
+}
+
+// sum of the finite distances, a cheap fingerprint of the whole answer
+static string distanceSum(const vector<int> &dist) {
+  long long sum = 0;
+  for (int d : dist) {
+    sum += d == INT_MAX ? 0 : d;
+  }
+  return to_string(sum);
+}
+
+static vector<Solver> allSolvers() {
+  vector<Solver> solvers;
+
+  solvers.push_back(Solver{
+      "matrix-chain", "matrices", [](uint64_t seed, double scale) {
+        vector<Case> cases;
+        for (long long n : {25, 50, 100, 200, 400}) {
+          n = scaled(n, scale);
+          cases.push_back(Case{"random-dims", n, [seed, n]() {
+            Rng rng(seed + n);
+            auto order = make_shared<vector<int>>(
+                randomMatrixChain(n, 1, 100, rng));
+            return Prepared{(double)n, [order]() {
+              return to_string(matrixChainMultiplication(*order));
+            }};
+          }});
+        }
+        return cases;
+      }});
+
+  solvers.push_back(Solver{
+      "dijkstra", "edges", [](uint64_t seed, double scale) {
+        vector<Case> cases;
+        for (long long V : {10000, 100000, 1000000}) {
+          V = scaled(V, scale);
+          int side = 1;
+          while ((long long)(side + 1) * (side + 1) <= V) {
+            side++;
+          }
+          const char *names[] = {"random", "grid", "power-law"};
+          for (int k = 0; k < 3; ++k) {
+            int n = k == 1 ? side * side : V;
+            cases.push_back(Case{names[k], n, [seed, k, n, side]() {
+              Rng rng(seed + n);
+              vector<Edge> edges =
+                  k == 0 ? randomGraph(n, 4LL * n, 1000, rng)
+                         : k == 1 ? gridGraph(side, side, 1000, rng)
+                                  : powerLawGraph(n, 4, 1000, rng);
+              // the graph is input too : built here, not timed
+              auto g = make_shared<dijkstra::Graph>(n, "undirected");
+              addEdges(*g, edges);
+              return Prepared{(double)edges.size(), [g]() {
+                g->shortest_path(0);
+                return distanceSum(g->distances());
+              }};
+            }});
+          }
+        }
+        return cases;
+      }});
+
+  solvers.push_back(Solver{
+      "bellman-ford", "edges", [](uint64_t seed, double scale) {
+        vector<Case> cases;
+        for (long long V : {250, 500, 1000, 2000}) {
+          V = scaled(V, scale);
+          cases.push_back(Case{"random-negative", V, [seed, V]() {
+            Rng rng(seed + V);
+            vector<Edge> edges = randomGraph(V, 4 * V, 1000, rng);
+            addPotentials(edges, V, 500, rng);
+            // V - 1 passes over all the edges
+            double units = (double)edges.size() * (V - 1);
+            auto g = make_shared<bellman_ford::Graph>(V, "directed");
+            addEdges(*g, edges);
+            return Prepared{units, [g]() {
+              if (!g->shortest_path(0)) {
+                return string("negative-cycle");
+              }
+              return distanceSum(g->distances());
+            }};
+          }});
+        }
+        return cases;
+      }});
+
+  solvers.push_back(Solver{
+      "nqueens", "solutions", [](uint64_t, double scale) {
+        vector<Case> cases;
+        // exponential : the scale adds to the board size instead
+        int extra = scale > 1 ? (int)(scale - 1) : 0;
+        for (int N : boardSizes(6, 11 + extra)) {
+          cases.push_back(Case{"board", N, [N]() {
+            // the work is only known after the run : the no of solutions
+            return Prepared{0, [N]() { return to_string(countNQueen(N)); }};
+          }});
+        }
+        return cases;
+      }});
+
+  solvers.push_back(Solver{
+      "billboard", "miles", [](uint64_t seed, double scale) {
+        vector<Case> cases;
+        for (long long M : {100000, 1000000, 10000000}) {
+          M = scaled(M, scale);
+          cases.push_back(Case{"random-sites", M, [seed, M]() {
+            Rng rng(seed + M);
+            auto sites = make_shared<BillboardSites>(
+                randomBillboards(M, M / 10, 5, 1000, rng));
+            return Prepared{(double)M, [sites]() {
+              return to_string(billboardConst(
+                  sites->M, sites->position.size(), sites->x,
+                  sites->position.data(), sites->revenue.data()));
+            }};
+          }});
+        }
+        return cases;
+      }});
+
+  solvers.push_back(Solver{
+      "subsequence", "events", [](uint64_t seed, double scale) {
+        vector<Case> cases;
+        for (long long n : {1000000, 10000000, 100000000}) {
+          n = scaled(n, scale);
+          cases.push_back(Case{"random-log", n, [seed, n]() {
+            Rng rng(seed + n);
+            auto log =
+                make_shared<vector<uint32_t>>(randomEventLog(n, 64, rng));
+            // ends with an event the log does not have : a full scan
+            auto pattern =
+                make_shared<vector<uint32_t>>(randomEventLog(16, 64, rng));
+            pattern->back() = 64;
+            return Prepared{(double)n, [log, pattern]() {
+              return string(isSubsequence(*pattern, *log) ? "yes" : "no");
+            }};
+          }});
+        }
+        return cases;
+      }});
+
+  return solvers;
+}
+
+// What one case measured
+struct Measured {
+  double seconds;  // best of the repetitions
+  double units;
+  long peakRssKB;  // 0 if not measured
+  string result;
+};
+
+static void timeCase(const Case &c, int repeat, Measured &m) {
+  Prepared input = c.prepare();
+  m.units = input.units;
+  for (int r = 0; r < repeat; ++r) {
+    Clock::time_point start = Clock::now();
+    m.result = input.run();
+    double elapsed = secondsSince(start);
+    m.seconds = r == 0 || elapsed < m.seconds ? elapsed : m.seconds;
+  }
+}
+
+// Runs a case in a child process of its own, so its peak RSS is not
+// raised by the memory earlier cases freed but the allocator kept. The
+// child sends back "<seconds> <units> <peak KB>\n<result>".
+//
+// The STAT_ counters need every case in one process, so builds with
+// -DSECTION_A_STATS (and systems without fork) run the cases in place and
+// do not measure memory.
+static bool measure(const Case &c, int repeat, Measured &m) {
+  m = Measured{0, 0, 0, ""};
+#if defined(HAVE_FORK) && !defined(SECTION_A_STATS)
+  int fd[2];
+  if (pipe(fd) != 0) {
+    return false;
+  }
+  cout.flush();
+  pid_t pid = fork();
+  if (pid < 0) {
+    return false;
+  }
+  if (pid == 0) {
+    close(fd[0]);
+    timeCase(c, repeat, m);
+    ostringstream msg;
+    msg.precision(17);
+    msg << m.seconds << " " << m.units << " " << peakRssKB() << "\n"
+        << m.result;
+    string data = msg.str();
+    bool ok = write(fd[1], data.data(), data.size()) == (ssize_t)data.size();
+    _exit(ok ? 0 : 1);
+  }
+
+  close(fd[1]);
+  string data;
+  char buf[4096];
+  ssize_t got;
+  while ((got = read(fd[0], buf, sizeof buf)) > 0) {
+    data.append(buf, got);
+  }
+  close(fd[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    return false;
+  }
+
+  istringstream msg(data);
+  if (!(msg >> m.seconds >> m.units >> m.peakRssKB)) {
+    return false;
+  }
+  msg.get(); // the newline
+  getline(msg, m.result, '\0');
+  return true;
+#else
+  timeCase(c, repeat, m);
+  return true;
+#endif
+}
+
+static void usage() {
+  cerr << "Usage : benchmark [--only <solver>] [--format csv|json] "
+          "[--output <file>]\n"
+          "                  [--seed <n>] [--repeat <n>] [--scale <x>] "
+          "[--list]\n";
+}
+
+int main(int argc, char *argv[]) {
+
+  Options opt;
+  const char *outputPath = nullptr;
+  vector<Solver> solvers = allSolvers();
+
+  for (int i = 1; i < argc; ++i) {
+    bool hasValue = i + 1 < argc;
+    if (strcmp(argv[i], "--list") == 0) {
+      for (auto &s : solvers) {
+        cout << s.name << "\n";
+      }
+      return 0;
+    } else if (strcmp(argv[i], "--only") == 0 && hasValue) {
+      opt.only = argv[++i];
+    } else if (strcmp(argv[i], "--format") == 0 && hasValue) {
+      opt.json = strcmp(argv[++i], "json") == 0;
+    } else if (strcmp(argv[i], "--output") == 0 && hasValue) {
+      outputPath = argv[++i];
+    } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+      opt.seed = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--repeat") == 0 && hasValue) {
+      opt.repeat = atoi(argv[++i]);
+      opt.repeat = opt.repeat > 0 ? opt.repeat : 1;
+    } else if (strcmp(argv[i], "--scale") == 0 && hasValue) {
+      opt.scale = strtod(argv[++i], nullptr);
+    } else {
+      usage();
+      return 1;
+    }
+  }
+
+  ofstream file;
+  if (outputPath) {
+    file.open(outputPath);
+    if (!file) {
+      cerr << "Error : could not create " << outputPath << "\n";
+      return 1;
+    }
+  }
+  ResultWriter writer(outputPath ? file : cout, opt.json);
+
+  for (auto &solver : solvers) {
+    if (solver.name.compare(0, opt.only.size(), opt.only) != 0) {
+      continue;
+    }
+
+    for (auto &c : solver.cases(opt.seed, opt.scale)) {
+      Measured m;
+      if (!measure(c, opt.repeat, m)) {
+        cerr << "Error : " << solver.name << " " << c.workload << " "
+             << c.size << " failed\n";
+        return 1;
+      }
+
+      double units = m.units ? m.units : strtod(m.result.c_str(), nullptr);
+
+      writer.write(BenchRecord{solver.name, c.workload, c.size, opt.seed,
+                               m.seconds, m.seconds > 0 ? units / m.seconds : 0,
+                               solver.unit, m.peakRssKB, m.result});
+    }
+  }
+
+  writer.finish();
+  return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14
+ *
+ * Objective : Seeded random inputs for every section-A problem
+ *
+ * Every generator draws from the mt19937_64 passed in, using plain
+ * modulo instead of std distributions (whose output differs between
+ * standard libraries), so a seed gives the same input everywhere.
+ *
+ */
+
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <cstdint>          // uint64_t
+#include <random>           // mt19937_64
+#include <vector>           // vector
+
+typedef std::mt19937_64 Rng;
+
+// uniform integer in [lo, hi]
+inline long long randomBetween(Rng &rng, long long lo, long long hi) {
+  return lo + static_cast<long long>(rng() % (uint64_t)(hi - lo + 1));
+}
+
+// ----------------------------------------------------------------- Q1
+
+// Order array of n matricies : matrix i is order[i-1] x order[i]
+inline std::vector<int> randomMatrixChain(int n, int minDim, int maxDim,
+                                          Rng &rng) {
+  std::vector<int> order(n + 1);
+  for (int &d : order) {
+    d = randomBetween(rng, minDim, maxDim);
+  }
+  return order;
+}
+
+// ----------------------------------------------------------------- Q2
+
+struct Edge {
+  int u, v, w;
+};
+
+// V vertices, about E edges, weights in [1, maxW]. A random spanning tree
+// is added first so every vertex is reachable from vertex 0.
+inline std::vector<Edge> randomGraph(int V, long long E, int maxW, Rng &rng) {
+  std::vector<Edge> edges;
+  edges.reserve(E);
+  for (int v = 1; v < V; ++v) {
+    int u = randomBetween(rng, 0, v - 1);
+    edges.push_back(Edge{u, v, (int)randomBetween(rng, 1, maxW)});
+  }
+  while ((long long)edges.size() < E) {
+    int u = randomBetween(rng, 0, V - 1);
+    int v = randomBetween(rng, 0, V - 1);
+    if (u != v) {
+      edges.push_back(Edge{u, v, (int)randomBetween(rng, 1, maxW)});
+    }
+  }
+  return edges;
+}
+
+// rows x cols grid, each cell joined to its right and lower neighbour.
+// Vertex of cell (r, c) is r * cols + c
+inline std::vector<Edge> gridGraph(int rows, int cols, int maxW, Rng &rng) {
+  std::vector<Edge> edges;
+  for (int r = 0; r < rows; ++r) {
+    for (int c = 0; c < cols; ++c) {
+      int u = r * cols + c;
+      if (c + 1 < cols) {
+        edges.push_back(Edge{u, u + 1, (int)randomBetween(rng, 1, maxW)});
+      }
+      if (r + 1 < rows) {
+        edges.push_back(Edge{u, u + cols, (int)randomBetween(rng, 1, maxW)});
+      }
+    }
+  }
+  return edges;
+}
+
+// Preferential attachment (Barabasi-Albert) : every new vertex joins `k`
+// existing vertices picked in proportion to their degree, which gives a
+// few hubs and a long tail of small degrees.
+inline std::vector<Edge> powerLawGraph(int V, int k, int maxW, Rng &rng) {
+  std::vector<Edge> edges;
+  std::vector<int> endpoints; // each vertex appears once per incident edge
+  for (int v = 1; v < V; ++v) {
+    int links = v < k ? v : k;
+    for (int l = 0; l < links; ++l) {
+      int u = endpoints.empty() || rng() % 4 == 0
+                  ? (int)randomBetween(rng, 0, v - 1)
+                  : endpoints[rng() % endpoints.size()];
+      edges.push_back(Edge{u, v, (int)randomBetween(rng, 1, maxW)});
+      endpoints.push_back(u);
+      endpoints.push_back(v);
+    }
+  }
+  return edges;
+}
+
+// Makes some weights of a directed graph negative without creating a
+// negative cycle : w(u,v) += p[u] - p[v] for a random potential p, which
+// leaves the weight of every cycle unchanged.
+inline void addPotentials(std::vector<Edge> &edges, int V, int maxShift,
+                          Rng &rng) {
+  std::vector<int> p(V);
+  for (int &x : p) {
+    x = randomBetween(rng, 0, maxShift);
+  }
+  for (Edge &e : edges) {
+    e.w += p[e.u] - p[e.v];
+  }
+}
+
+// ----------------------------------------------------------------- Q3
+
+// board sizes from `from` to `to`
+inline std::vector<int> boardSizes(int from, int to) {
+  std::vector<int> sizes;
+  for (int n = from; n <= to; ++n) {
+    sizes.push_back(n);
+  }
+  return sizes;
+}
+
+// ----------------------------------------------------------------- Q4
+
+struct BillboardSites {
+  int M; // length of the highway in miles
+  int x; // billboards must be more than x miles apart
+  std::vector<int> position; // distinct, sorted, in 1..M
+  std::vector<int> revenue;
+};
+
+inline BillboardSites randomBillboards(int M, int n, int x, int maxRevenue,
+                                       Rng &rng) {
+  BillboardSites sites{M, x, {}, {}};
+  n = n < M ? n : M;
+
+  // pick n distinct miles : each mile is taken with the probability of
+  // the places still needed over the miles still left
+  for (int mile = 1; mile <= M && (int)sites.position.size() < n; ++mile) {
+    int needed = n - sites.position.size();
+    int left = M - mile + 1;
+    if ((long long)(rng() % left) < needed) {
+      sites.position.push_back(mile);
+      sites.revenue.push_back(randomBetween(rng, 1, maxRevenue));
+    }
+  }
+  return sites;
+}
+
+// ----------------------------------------------------------------- Q5
+
+// n events drawn from `distinct` event ids
+inline std::vector<uint32_t> randomEventLog(size_t n, uint32_t distinct,
+                                            Rng &rng) {
+  std::vector<uint32_t> events(n);
+  for (uint32_t &e : events) {
+    e = rng() % distinct;
+  }
+  return events;
+}
+
+#endif
@@ -0,0 +1,507 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 -O2 [-DSECTION_A_STATS]
+ *
+ * Objective : Show that the STAT_ macros cost nothing when they are off
+ *
+ * Times the instrumented solvers (N-Queens, matrix chain, billboard,
+ * Dijkstra, Bellman-Ford and subsequence) against copies of the same code
+ * without the STAT_ lines. Built without -DSECTION_A_STATS the ratio
+ * should stay within noise of 1.00, built with it the ratio is the cost
+ * of counting.
+ *
+ * Usage :
+ *   stats-overhead [repeat]
+ *
+ */
+
+#include <algorithm>        // max
+#include <cstdlib>          // atoi
+#include <functional>       // function
+#include <iomanip>          // setw, setprecision
+#include <iostream>         // cout
+#include <limits.h>         // INT_MAX
+#include <list>             // list
+#include <queue>            // priority_queue
+#include <utility>          // pair
+#include <vector>           // vector
+
+#include "bench.h"
+#include "generators.h"
+
+#include "../Q1/matrix-chain-multiplication.h"
+#include "../Q2/bellman-ford-shortest-path.h"
+#include "../Q2/dijkstra-shortest-path.h"
+#include "../Q3/NQueens.h"
+#include "../Q4/highway-billboard-problem.h"
+#include "../Q5/subsequence.h"
+
+using namespace std;
+
+// ---------------------------------------------- uninstrumented copies
+//
+// Each one is the instrumented solver line for line, with the STAT_ lines
+// (and an if left with nothing else in it) taken out. The solver headers
+// point here, a change to a solver has to be made in its copy too. They
+// are inline like the originals, so the compiler makes the same inlining
+// choices : a static copy gets inlined differently, which alone moved
+// some ratios by 2x.
+
+inline bool plainIsSafe(int **board, int N, int row, int col) {
+
+  // Check this row on left side
+  for (int i = 0; i < col; i++)
+    if (board[row][i])
+      return false;
+
+  // Check upper diagonal on left side
+  for (int i = row, j = col; i >= 0 && j >= 0; i--, j--)
+    if (board[i][j])
+      return false;
+
+  // Check lower diagonal on left side
+  for (int i = row, j = col; i < N && j >= 0; i++, j--)
+    if (board[i][j])
+      return false;
+
+  return true;
+}
+
+inline long long plainCountNQueenHelper(int **board, int N, int col) {
+
+  if (col == N) {
+    return 1;
+  }
+
+  long long count = 0;
+  for (int row = 0; row < N; row++) {
+    // check at board[i][col]
+    if (plainIsSafe(board, N, row, col)) {
+      board[row][col] = 1;
+      count += plainCountNQueenHelper(board, N, col + 1);
+      board[row][col] = 0; // backtrack
+    }
+  }
+
+  return count;
+}
+
+inline long long plainCountNQueen(int N) {
+
+  // allocate board
+  int **board = new int *[N];
+  for (int i = 0; i < N; i++) {
+    board[i] = new int[N]{0};
+  }
+
+  int startingCol = 0;
+  long long noOfSolutions = plainCountNQueenHelper(board, N, startingCol);
+
+  // de-allocate board
+  for (int i = 0; i < N; ++i) {
+    delete[] board[i];
+  }
+  delete[] board;
+
+  return noOfSolutions;
+}
+
+inline int plainMatrixChain(const vector<int> &order,
+                            vector<vector<int>> &brackets) {
+
+  // no of matricies : from 1 to n
+  int n = order.size() - 1;
+
+  // Table rows and columns are labelled from 1 to n
+  // so for simplicity allocate n+1 rows and columns
+  vector<vector<int>> memo(n + 1, vector<int>(n + 1));
+  brackets.assign(n + 1, vector<int>(n + 1));
+
+  // for chainSize = 1  : m[1,1] .. m[2,2] .. m[n,n] :: multiplication cost = 0
+  for (int i = 1; i <= n; ++i) {
+    memo[i][i] = 0;
+  }
+
+  // for chainSize = 2 to n
+  for (int chainSize = 2; chainSize <= n; ++chainSize) {
+
+    // establish an interval (start..end) of size = chainSize
+    // and loop through all possible intervals of size = chainSize
+    for (int start = 1; start + chainSize - 1 <= n; ++start) {
+
+      int end = start + chainSize - 1;
+
+      int minCostOfInterval = INT_MAX;
+      int partitionIndex = start;
+
+      // partition current interval into subintervals (start..part), (part+1,
+      // end) and find out which of them costs minimum
+      for (int part = start; part + 1 <= end; ++part) {
+
+        int currentSubIntervalCost =
+            memo[start][part] + memo[part + 1][end] +
+            order[start - 1] * order[part] * order[end];
+
+        if (currentSubIntervalCost < minCostOfInterval) {
+          minCostOfInterval = currentSubIntervalCost;
+          partitionIndex = part;
+        }
+      }
+      memo[start][end] = minCostOfInterval;
+      brackets[start][end] = partitionIndex;
+    }
+  }
+
+  return n >= 1 ? memo[1][n] : 0;
+}
+
+inline int plainMatrixChain(const vector<int> &order) {
+  vector<vector<int>> brackets;
+  return plainMatrixChain(order, brackets);
+}
+
+inline int plainBillboard(int M, int n, int x, const int position[],
+                          const int revenue[]) {
+
+  // store revenue at each mile
+  vector<int> maxRev(M + 1, 0);
+
+  int next = 0;
+  for (int i = 1; i <= M; i++) {
+
+    // check if all billboards are already placed.
+    if (next < n) {
+
+      // check if we have billboard at this position
+      // If not, simply used the previous value
+      if (position[next] != i) {
+        maxRev[i] = maxRev[i - 1];
+      } else {
+
+        // if current pos <= x, then we can have only one billboard.
+        if (i <= x) {
+          maxRev[i] = max(maxRev[i - 1], revenue[next]);
+        } else {
+          // place next bill board, or, not place it
+          maxRev[i] = max(maxRev[i - x - 1] + revenue[next], maxRev[i - 1]);
+        }
+        next++;
+      }
+    } else {
+      maxRev[i] = maxRev[i - 1];
+    }
+  }
+
+  return maxRev[M];
+}
+
+typedef pair<int, int> pii;
+typedef list<pii> lpii;
+
+// dijkstra::Graph cut down to what shortest_path() uses
+class PlainDijkstra {
+
+  private:
+    int V;
+    lpii *adjList;
+    int source;
+
+  public:
+    vector<int> dist;
+    vector<int> parent;
+
+    PlainDijkstra(int _V) : V(_V), adjList(new lpii[_V]), source(-1) {}
+    ~PlainDijkstra() { delete[] adjList; }
+    PlainDijkstra(const PlainDijkstra &) = delete;
+    PlainDijkstra &operator=(const PlainDijkstra &) = delete;
+
+    void add_edge(int u, int v, int w) {
+      adjList[u].push_back({v, w});
+      adjList[v].push_back({u, w});
+    }
+
+    void shortest_path(int src);
+};
+
+inline void PlainDijkstra::shortest_path(int src) {
+
+  struct comparer{
+  	bool operator()(const pii& a, const pii& b) { return a.first > b.first; }
+  };
+  priority_queue<pii, vector<pii>, comparer> pq;
+
+  source = src;
+
+  // distance to each vertex
+  dist.assign(V, INT_MAX);
+
+  dist[src] = 0;             // distance from source to source always zero
+  pq.push({dist[src], src}); // pair of (distance from source to V, V)
+
+  parent.assign(V, -1);  // create a parent to store path info
+  parent[src] = -1;      // parent of source is base case
+
+  // In Djikstra, vertex is extracted only once, thereafter it is not updated
+  vector<bool> firstExtraction(V, true);
+
+  // loop until all vertices have been extracted
+  while (!pq.empty()) {
+
+    // extract minimum distance vertex from pq
+    int u = pq.top().second;    // .second gives the vertex label
+    pq.pop();
+    firstExtraction[u] = false;
+
+    // iterate all adjacent vertices to `u`
+    for (auto x : adjList[u]) {
+
+      int v = x.first;      // dest of edge
+      int w = x.second;     // weight of the edge
+
+      // if already extracted, do not proceed
+      // update cost of all adjacent vertices
+      if (firstExtraction[v] && (dist[u] + w < dist[v])) {
+        dist[v] = dist[u] + w;
+		parent[v] = u;
+		
+		pq.push({dist[v], v});
+      }
+    }
+  }
+}
+
+// bellman_ford::Graph cut down to what shortest_path() uses
+class PlainBellmanFord {
+
+private:
+  int V;
+  lpii *adjList;
+
+public:
+  vector<int> dist;
+  vector<int> parent;
+
+  PlainBellmanFord(int _V) : V(_V), adjList(new lpii[_V]) {}
+  ~PlainBellmanFord() { delete[] adjList; }
+  PlainBellmanFord(const PlainBellmanFord &) = delete;
+  PlainBellmanFord &operator=(const PlainBellmanFord &) = delete;
+
+  void add_edge(int u, int v, int w) { adjList[u].push_back({v, w}); }
+
+  bool shortest_path(int src);
+};
+
+inline bool PlainBellmanFord::shortest_path(int src) {
+
+  int V = this->V;
+
+  // distance to each vertex
+  dist.assign(V, INT_MAX);
+  dist[src] = 0; // distance from source to source always zero
+
+  parent.assign(V, -1); // create a parent to store path info
+  parent[src] = -1;     // parent of source is base case
+
+  // outer loop executes V-1 times
+  for (int count = 1; count <= V - 1; ++count) {
+
+    // Inner loop executes E times
+    // Adjacency List Representation of the Graph, essentially traverses all E's
+    for (int i = 0; i < V; ++i) {
+      for (auto x : adjList[i]) {
+
+        int u = i;        // source of the edge
+        int v = x.first;  // dest of edge
+        int w = x.second; // weight of the edge
+
+        if (dist[u] != INT_MAX && (dist[u] + w < dist[v])) {
+          dist[v] = dist[u] + w;
+          parent[v] = u;
+        }
+      }
+    }
+  }
+
+  // traverse all Edges once more,
+  // if anything gets updated, it contains a negative cycle.
+  for (int i = 0; i < V; ++i) {
+    for (auto x : adjList[i]) {
+      int u = i;
+      int v = x.first;
+      int w = x.second;
+
+      if (dist[u] != INT_MAX && (dist[u] + w < dist[v])) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+bool plainIsSubsequence(const vector<T> &B, const vector<T> &A) {
+
+  size_t m = A.size();
+  size_t n = B.size();
+
+  if (m < n) {
+    return false;
+  }
+
+  size_t j = 0;
+  size_t i = 0;
+  for (; i < m && j < n; ++i) {
+    if (A[i] == B[j]) {
+      j++;
+    }
+  }
+
+  return (j == n);
+}
+
+// sum of the reachable distances, to compare the two versions
+static long long distanceSum(const vector<int> &dist) {
+  long long sum = 0;
+  for (int d : dist) {
+    sum += d == INT_MAX ? 0 : d;
+  }
+  return sum;
+}
+
+// ------------------------------------------------------------ driver
+
+// both versions are called through a function, so the compiler cannot
+// inline one into the driver and not the other. Inlined into main, the
+// instrumented subsequence scan ran at half the speed of its copy.
+typedef function<long long()> Solve;
+
+static long long timed(const Solve &solve, double &seconds) {
+  Clock::time_point start = Clock::now();
+  long long res = solve();
+  seconds = secondsSince(start);
+  return res;
+}
+
+// best of `repeat` runs of each version. One untimed run of each first,
+// so page faults and the first touch of the input are not timed, then the
+// two take turns at going first so that neither always runs on a cache
+// the other has warmed or in the clock state the other left.
+static void compare(const char *name, int repeat, const Solve &instrumented,
+                    const Solve &plain) {
+  instrumented();
+  plain();
+
+  double bestA = 0, bestB = 0;
+  for (int r = 0; r < repeat; ++r) {
+    double tA, tB;
+    long long a, b;
+    if (r % 2 == 0) {
+      a = timed(instrumented, tA);
+      b = timed(plain, tB);
+    } else {
+      b = timed(plain, tB);
+      a = timed(instrumented, tA);
+    }
+
+    if (a != b) {
+      cerr << "Error : " << name << " results differ\n";
+      exit(1);
+    }
+    bestA = r == 0 || tA < bestA ? tA : bestA;
+    bestB = r == 0 || tB < bestB ? tB : bestB;
+  }
+  cout << setw(16) << name << setw(16) << bestA * 1e3 << setw(16)
+       << bestB * 1e3 << setw(10) << bestA / bestB << "\n";
+}
+
+int main(int argc, char *argv[]) {
+
+  int repeat = argc >= 2 ? atoi(argv[1]) : 5;
+  repeat = repeat > 0 ? repeat : 1;
+
+#ifdef SECTION_A_STATS
+  cout << "stats : ON\n\n";
+#else
+  cout << "stats : OFF\n\n";
+#endif
+
+  Rng rng(1);
+  vector<int> order = randomMatrixChain(300, 1, 100, rng);
+  BillboardSites sites = randomBillboards(20000000, 2000000, 5, 1000, rng);
+
+  cout << fixed << setprecision(3);
+  cout << setw(16) << "solver" << setw(16) << "instrumented" << setw(16)
+       << "plain (ms)" << setw(10) << "ratio" << "\n";
+
+  compare("nqueens-12", repeat, []() { return countNQueen(12); },
+          []() { return plainCountNQueen(12); });
+
+  compare("matrix-300", repeat,
+          [&]() { return (long long)matrixChainMultiplication(order); },
+          [&]() { return (long long)plainMatrixChain(order); });
+
+  int n = sites.position.size();
+  compare("billboard-20M", repeat,
+          [&]() {
+            return (long long)billboardConst(sites.M, n, sites.x,
+                                             sites.position.data(),
+                                             sites.revenue.data());
+          },
+          [&]() {
+            return (long long)plainBillboard(sites.M, n, sites.x,
+                                             sites.position.data(),
+                                             sites.revenue.data());
+          });
+
+  // the graphs are built once, only shortest_path() is timed
+  const int V = 200000, bellmanV = 2000;
+  vector<Edge> edges = randomGraph(V, 4LL * V, 1000, rng);
+  dijkstra::Graph dg(V, "undirected");
+  PlainDijkstra pd(V);
+  for (const Edge &e : edges) {
+    dg.add_edge(e.u, e.v, e.w);
+    pd.add_edge(e.u, e.v, e.w);
+  }
+  compare("dijkstra-200K", repeat,
+          [&]() {
+            dg.shortest_path(0);
+            return distanceSum(dg.distances());
+          },
+          [&]() {
+            pd.shortest_path(0);
+            return distanceSum(pd.dist);
+          });
+
+  vector<Edge> negative = randomGraph(bellmanV, 4LL * bellmanV, 1000, rng);
+  addPotentials(negative, bellmanV, 500, rng);
+  bellman_ford::Graph bg(bellmanV, "directed");
+  PlainBellmanFord pb(bellmanV);
+  for (const Edge &e : negative) {
+    bg.add_edge(e.u, e.v, e.w);
+    pb.add_edge(e.u, e.v, e.w);
+  }
+  compare("bellman-2K", repeat,
+          [&]() {
+            bg.shortest_path(0);
+            return distanceSum(bg.distances());
+          },
+          [&]() {
+            pb.shortest_path(0);
+            return distanceSum(pb.dist);
+          });
+
+  // ends with an event the log does not have : a full scan
+  vector<uint32_t> log = randomEventLog(50000000, 64, rng);
+  vector<uint32_t> pattern = randomEventLog(16, 64, rng);
+  pattern.back() = 64;
+  compare("subsequence-50M", repeat,
+          [&]() { return (long long)isSubsequence(pattern, log); },
+          [&]() { return (long long)plainIsSubsequence(pattern, log); });
+
+  return 0;
+}
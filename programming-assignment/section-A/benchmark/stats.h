@@ -0,0 +1,208 @@
+/*
+ * Author : agent
+ * Date   : Oct-2026
+ *
+ * Platform : Linux
+ * Compiler : g++ 12.2.0
+ * flags    : -std=c++14 [-DSECTION_A_STATS]
+ *
+ * Objective : Counters and phase timers for the hot loops of the solvers
+ *
+ *   STAT_COUNT("dijkstra.relaxations");       // +1
+ *   STAT_ADD("subsequence.events", n);        // +n
+ *   STAT_PHASE("dijkstra.shortest_path");     // times the enclosing scope
+ *
+ * Without -DSECTION_A_STATS the macros expand to nothing, so the solvers
+ * compile exactly as if they were not there.
+ *
+ * With it, every thread counts into its own thread_local table (no locks
+ * or atomics on the hot path) which is merged when the thread exits. At
+ * exit a report is printed to stderr, and written as JSON to the file
+ * named by the STATS_JSON environment variable if it is set.
+ *
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#ifdef SECTION_A_STATS
+
+#include <chrono>           // steady_clock
+#include <cstdint>          // uint64_t
+#include <cstdio>           // fprintf
+#include <cstdlib>          // atexit, getenv
+#include <mutex>            // mutex, lock_guard
+#include <string>           // string
+#include <vector>           // vector
+
+namespace stats {
+
+// more than enough for every call site in section-A
+const int MAX_STATS = 128;
+
+struct Table {
+  uint64_t count[MAX_STATS];
+  uint64_t nanos[MAX_STATS]; // phases only
+  Table() {
+    for (int i = 0; i < MAX_STATS; ++i) {
+      count[i] = nanos[i] = 0;
+    }
+  }
+  void addTo(Table &total) const {
+    for (int i = 0; i < MAX_STATS; ++i) {
+      total.count[i] += count[i];
+      total.nanos[i] += nanos[i];
+    }
+  }
+};
+
+// Shared state. Allocated once and never freed, so it is still alive
+// while thread_local tables are destroyed at exit.
+struct Registry {
+  std::mutex lock;
+  std::vector<std::string> names;
+  std::vector<bool> isPhase;
+  Table finished;              // tables of threads that have exited
+  std::vector<Table *> live;   // tables of running threads
+};
+
+inline Registry &registry() {
+  static Registry *r = new Registry();
+  return *r;
+}
+
+inline void report();
+
+// one id per call site, looked up once thanks to the static in the macros
+inline int statId(const char *name, bool phase) {
+  Registry &r = registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  if (r.names.empty()) {
+    atexit(report);
+  }
+  for (size_t i = 0; i < r.names.size(); ++i) {
+    if (r.names[i] == name) {
+      return i;
+    }
+  }
+  if (r.names.size() == MAX_STATS) {
+    fprintf(stderr, "stats : too many counters, %s is not counted\n", name);
+    return MAX_STATS - 1;
+  }
+  r.names.push_back(name);
+  r.isPhase.push_back(phase);
+  return r.names.size() - 1;
+}
+
+struct ThreadTable {
+  Table table;
+  ThreadTable() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    r.live.push_back(&table);
+  }
+  ~ThreadTable() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    table.addTo(r.finished);
+    for (size_t i = 0; i < r.live.size(); ++i) {
+      if (r.live[i] == &table) {
+        r.live.erase(r.live.begin() + i);
+        break;
+      }
+    }
+  }
+};
+
+inline Table &local() {
+  thread_local ThreadTable t;
+  return t.table;
+}
+
+// adds the time from construction to destruction to a phase
+class PhaseTimer {
+  int id;
+  std::chrono::steady_clock::time_point start;
+
+public:
+  explicit PhaseTimer(int _id)
+      : id(_id), start(std::chrono::steady_clock::now()) {}
+  ~PhaseTimer() {
+    Table &t = local();
+    t.count[id]++;
+    t.nanos[id] += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  }
+};
+
+inline Table totals() {
+  Registry &r = registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  Table total;
+  r.finished.addTo(total);
+  for (Table *t : r.live) {
+    t->addTo(total);
+  }
+  return total;
+}
+
+inline void report() {
+  Table total = totals();
+  Registry &r = registry();
+
+  fprintf(stderr, "\n%-40s %16s %14s\n", "stat", "count", "time (ms)");
+  for (size_t i = 0; i < r.names.size(); ++i) {
+    fprintf(stderr, "%-40s %16llu", r.names[i].c_str(),
+            (unsigned long long)total.count[i]);
+    if (r.isPhase[i]) {
+      fprintf(stderr, " %14.3f", total.nanos[i] / 1e6);
+    }
+    fprintf(stderr, "\n");
+  }
+
+  const char *path = getenv("STATS_JSON");
+  FILE *out = path ? fopen(path, "w") : nullptr;
+  if (out) {
+    fprintf(out, "{");
+    for (size_t i = 0; i < r.names.size(); ++i) {
+      fprintf(out, "%s\n  \"%s\": {\"count\": %llu", i ? "," : "",
+              r.names[i].c_str(), (unsigned long long)total.count[i]);
+      if (r.isPhase[i]) {
+        fprintf(out, ", \"ms\": %.3f", total.nanos[i] / 1e6);
+      }
+      fprintf(out, "}");
+    }
+    fprintf(out, "\n}\n");
+    fclose(out);
+  }
+}
+
+} // namespace stats
+
+#define STAT_ADD(name, n)                                                      \
+  do {                                                                         \
+    static const int statId_ = stats::statId(name, false);                     \
+    stats::local().count[statId_] += (n);                                      \
+  } while (0)
+
+#define STAT_COUNT(name) STAT_ADD(name, 1)
+
+#define STAT_CONCAT_(a, b) a##b
+#define STAT_CONCAT(a, b) STAT_CONCAT_(a, b)
+
+#define STAT_PHASE(name)                                                       \
+  static const int STAT_CONCAT(phaseId_, __LINE__) =                           \
+      stats::statId(name, true);                                               \
+  stats::PhaseTimer STAT_CONCAT(phaseTimer_, __LINE__)(                        \
+      STAT_CONCAT(phaseId_, __LINE__))
+
+#else
+
+#define STAT_ADD(name, n) ((void)0)
+#define STAT_COUNT(name) ((void)0)
+#define STAT_PHASE(name) ((void)0)
+
+#endif
+
+#endif